@@ -4,6 +4,7 @@
 #include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
 
+template <samurai::CellListBackend backend>
 static void BM_CellListConstruction_2D(benchmark::State& state)
 {
     constexpr std::size_t dim = 2;
@@ -11,7 +12,7 @@ static void BM_CellListConstruction_2D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
 
     for (auto _ : state)
     {
@@ -26,8 +27,10 @@ static void BM_CellListConstruction_2D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellListConstruction_2D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_2D, samurai::CellListBackend::map)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_2D, samurai::CellListBackend::flat)->Range(8, 8 << 18);
 
+template <samurai::CellListBackend backend>
 static void BM_CellListConstruction_3D(benchmark::State& state)
 {
     constexpr std::size_t dim = 3;
@@ -35,7 +38,7 @@ static void BM_CellListConstruction_3D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
 
     for (auto _ : state)
     {
@@ -51,8 +54,10 @@ static void BM_CellListConstruction_3D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellListConstruction_3D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_3D, samurai::CellListBackend::map)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_3D, samurai::CellListBackend::flat)->Range(8, 8 << 18);
 
+template <samurai::CellListBackend backend>
 static void BM_CellList2CellArray_2D(benchmark::State& state)
 {
     constexpr std::size_t dim = 2;
@@ -60,7 +65,7 @@ static void BM_CellList2CellArray_2D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
     samurai::CellArray<dim> ca;
 
     for (std::size_t s = 0; s < state.range(0); ++s)
@@ -78,8 +83,10 @@ static void BM_CellList2CellArray_2D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellList2CellArray_2D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_2D, samurai::CellListBackend::map)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_2D, samurai::CellListBackend::flat)->Range(8, 8 << 18);
 
+template <samurai::CellListBackend backend>
 static void BM_CellList2CellArray_3D(benchmark::State& state)
 {
     constexpr std::size_t dim = 3;
@@ -87,7 +94,7 @@ static void BM_CellList2CellArray_3D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
     samurai::CellArray<dim> ca;
 
     for (std::size_t s = 0; s < state.range(0); ++s)
@@ -106,4 +113,65 @@ static void BM_CellList2CellArray_3D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellList2CellArray_3D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_3D, samurai::CellListBackend::map)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_3D, samurai::CellListBackend::flat)->Range(8, 8 << 18);
+
+// Cell by cell insertion in increasing order, as done by update_field.
+// One cell out of two is added so that each row holds size / 2 intervals.
+template <samurai::CellListBackend backend>
+static void BM_CellListMonotoneInsertion_2D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+
+    const auto level = static_cast<std::size_t>(state.range(0));
+    const int size   = 1 << level;
+
+    for (auto _ : state)
+    {
+        samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
+
+        for (int y = 0; y < size; ++y)
+        {
+            for (int x = 0; x < size; x += 2)
+            {
+                cl[level][{y}].add_point(x);
+            }
+        }
+        benchmark::DoNotOptimize(cl);
+    }
+    state.SetItemsProcessed(state.iterations() * size * size / 2);
+}
+
+BENCHMARK_TEMPLATE(BM_CellListMonotoneInsertion_2D, samurai::CellListBackend::map)->DenseRange(12, 13)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CellListMonotoneInsertion_2D, samurai::CellListBackend::flat)->DenseRange(12, 13)->Unit(benchmark::kMillisecond);
+
+// Same as above in a 64x64 bundle of rows along x
+template <samurai::CellListBackend backend>
+static void BM_CellListMonotoneInsertion_3D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 3;
+
+    const auto level = static_cast<std::size_t>(state.range(0));
+    const int size   = 1 << level;
+
+    for (auto _ : state)
+    {
+        samurai::CellList<dim, samurai::default_config::interval_t, samurai::default_config::max_level, backend> cl;
+
+        for (int z = 0; z < 64; ++z)
+        {
+            for (int y = 0; y < 64; ++y)
+            {
+                for (int x = 0; x < size; x += 2)
+                {
+                    cl[level][{y, z}].add_point(x);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(cl);
+    }
+    state.SetItemsProcessed(state.iterations() * 64 * 64 * size / 2);
+}
+
+BENCHMARK_TEMPLATE(BM_CellListMonotoneInsertion_3D, samurai::CellListBackend::map)->DenseRange(12, 13)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CellListMonotoneInsertion_3D, samurai::CellListBackend::flat)->DenseRange(12, 13)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,186 @@
+#ifdef SAMURAI_WITH_OPENMP
+#include <omp.h>
+#endif
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+// Gaussian bump on a 2D multiresolution mesh: the adaptation creates level jumps around the bump
+template <class Mesh>
+auto make_bump(Mesh& mesh)
+{
+    auto u = samurai::make_field<1>("u",
+                                    mesh,
+                                    [](const auto& x)
+                                    {
+                                        return std::exp(-50 * (x[0] * x[0] + x[1] * x[1]));
+                                    });
+    samurai::make_bc<samurai::Dirichlet<1>>(u, 0.);
+
+    auto adapt = samurai::make_MRAdapt(u);
+    adapt(1e-3, 1);
+    samurai::update_ghost_mr(u);
+    return u;
+}
+
+template <class Scheme, class Field>
+void bench_scheme(benchmark::State& state, Scheme& scheme, Field& u)
+{
+#ifdef SAMURAI_WITH_OPENMP
+    omp_set_num_threads(static_cast<int>(state.range(0)));
+#endif
+    for (auto _ : state)
+    {
+        auto flux = scheme(u);
+        benchmark::DoNotOptimize(flux.array().data());
+    }
+    state.counters["nb cells"] = static_cast<double>(u.mesh().nb_cells(Field::mesh_t::mesh_id_t::cells));
+}
+
+// Non-linear flux (Burgers): contributions added cell by cell
+template <samurai::FluxAccumulation accumulation>
+void BM_Burgers_Accumulation(benchmark::State& state)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2>> mesh{box, 2, 9};
+    auto u = make_bump(mesh);
+
+    auto conv = samurai::make_convection_upwind<decltype(u)>();
+    conv.set_flux_accumulation(accumulation);
+    bench_scheme(state, conv, u);
+}
+
+// Linear homogeneous flux: contributions added interval by interval
+template <samurai::FluxAccumulation accumulation>
+void BM_Upwind_Accumulation(benchmark::State& state)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2>> mesh{box, 2, 9};
+    auto u = make_bump(mesh);
+
+    auto conv = samurai::make_convection_upwind<decltype(u)>(samurai::VelocityVector<2>{1., 1.});
+    conv.set_flux_accumulation(accumulation);
+    bench_scheme(state, conv, u);
+}
+
+// Non-linear flux called cell by cell, through its std::function (as a user-defined FluxDefinition)
+// or inlined (as defined by make_convection_*())
+template <bool type_erased_flux, class Scheme>
+void bench_flux_call(benchmark::State& state, Scheme& conv)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2, 3>> mesh{box, 2, 9};
+    auto u = make_bump(mesh);
+
+    for (std::size_t d = 0; d < 2; ++d)
+    {
+        conv.flux_definition()[d].set_cons_interval_flux_function(nullptr); // flux called cell by cell
+        if constexpr (type_erased_flux)
+        {
+            // Wrapping the flux hides its type from the scheme
+            auto flux                                     = conv.flux_definition()[d].cons_flux_function;
+            conv.flux_definition()[d].cons_flux_function = [flux](auto& cells, const auto& field)
+            {
+                return flux(cells, field);
+            };
+        }
+    }
+    bench_scheme(state, conv, u);
+}
+
+template <bool type_erased_flux>
+void BM_Burgers_Upwind_FluxCall(benchmark::State& state)
+{
+    using Field = samurai::Field<samurai::MRMesh<samurai::MRConfig<2, 3>>, double, 1>;
+    auto conv   = samurai::make_convection_upwind<Field>();
+    bench_flux_call<type_erased_flux>(state, conv);
+}
+
+template <bool type_erased_flux>
+void BM_Burgers_Weno5_FluxCall(benchmark::State& state)
+{
+    using Field = samurai::Field<samurai::MRMesh<samurai::MRConfig<2, 3>>, double, 1>;
+    auto conv   = samurai::make_convection_weno5<Field>();
+    bench_flux_call<type_erased_flux>(state, conv);
+}
+
+// Non-linear flux computed cell by cell or interval by interval
+template <bool interval_flux>
+void BM_Burgers_Upwind_IntervalFlux(benchmark::State& state)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2>> mesh{box, 2, 9};
+    auto u = make_bump(mesh);
+
+    auto conv = samurai::make_convection_upwind<decltype(u)>();
+    if constexpr (!interval_flux)
+    {
+        for (std::size_t d = 0; d < 2; ++d)
+        {
+            conv.flux_definition()[d].set_cons_interval_flux_function(nullptr);
+        }
+    }
+    bench_scheme(state, conv, u);
+}
+
+// Sum of a linear (diffusion) and a non-linear (Burgers) operator: one mesh traversal per operator, or a single fused one
+template <bool fused>
+void BM_Diffusion_Burgers_Sum(benchmark::State& state)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2>> mesh{box, 2, 9};
+    auto u = make_bump(mesh);
+
+    auto diff = samurai::make_diffusion_order2<decltype(u)>(0.1);
+    auto conv = samurai::make_convection_upwind<decltype(u)>();
+    auto rhs  = diff + conv;
+    rhs.fused_evaluation(fused);
+    bench_scheme(state, rhs, u);
+}
+
+// Explicit Euler step unp1 = u - dt * conv(u): with a temporary field, or computed into unp1 by apply_axpy()
+template <bool axpy>
+void BM_Burgers_EulerStep(benchmark::State& state)
+{
+    samurai::Box<double, 2> box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<samurai::MRConfig<2>> mesh{box, 2, 9};
+    auto u    = make_bump(mesh);
+    auto unp1 = samurai::make_field<1>("unp1", mesh);
+
+    auto conv = samurai::make_convection_upwind<decltype(u)>();
+    double dt = 1e-3;
+#ifdef SAMURAI_WITH_OPENMP
+    omp_set_num_threads(static_cast<int>(state.range(0)));
+#endif
+    for (auto _ : state)
+    {
+        if constexpr (axpy)
+        {
+            conv.apply_axpy(unp1, 1., u, -dt);
+        }
+        else
+        {
+            unp1 = u - dt * conv(u);
+        }
+        benchmark::DoNotOptimize(unp1.array().data());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Burgers_Accumulation, samurai::FluxAccumulation::Atomic)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Burgers_Accumulation, samurai::FluxAccumulation::Colored)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Upwind_Accumulation, samurai::FluxAccumulation::Atomic)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Upwind_Accumulation, samurai::FluxAccumulation::Colored)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Burgers_Upwind_FluxCall, true)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Burgers_Upwind_FluxCall, false)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Burgers_Weno5_FluxCall, true)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Burgers_Weno5_FluxCall, false)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Burgers_Upwind_IntervalFlux, false)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Burgers_Upwind_IntervalFlux, true)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Diffusion_Burgers_Sum, false)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Diffusion_Burgers_Sum, true)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Burgers_EulerStep, false)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Burgers_EulerStep, true)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
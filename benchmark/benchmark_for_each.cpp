@@ -0,0 +1,55 @@
+#ifdef SAMURAI_WITH_OPENMP
+#include <omp.h>
+#endif
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <samurai/algorithm.hpp>
+#include <samurai/cell_array.hpp>
+#include <samurai/cell_list.hpp>
+
+// 2D mesh refined around a corner: the rows of the finest levels are much longer than the others,
+// so one task per interval or one block of intervals per thread gives an unbalanced work.
+auto generate_corner_mesh(std::size_t min_level, std::size_t max_level)
+{
+    samurai::CellList<2> cl;
+    for (std::size_t level = min_level; level <= max_level; ++level)
+    {
+        int size = 1 << level;
+        int band = (level == max_level) ? size / 2 : size / 4;
+        for (int j = 0; j < size; ++j)
+        {
+            int start = (j < band) ? 0 : size / 2;
+            cl[level][{j}].add_interval({start, (j < band) ? size / 2 : size});
+        }
+    }
+    return samurai::CellArray<2>(cl);
+}
+
+template <samurai::Run run_type>
+void BM_ForEachCell_Threads(benchmark::State& state)
+{
+    auto ca = generate_corner_mesh(4, 11);
+#ifdef SAMURAI_WITH_OPENMP
+    omp_set_num_threads(static_cast<int>(state.range(0)));
+#endif
+    std::vector<double> u(ca.nb_cells());
+    for (auto _ : state)
+    {
+        samurai::for_each_cell<run_type>(ca,
+                                         [&](const auto& cell)
+                                         {
+                                             auto x                                  = cell.center();
+                                             u[static_cast<std::size_t>(cell.index)] = std::sin(x[0]) * std::cos(x[1]);
+                                         });
+        benchmark::DoNotOptimize(u.data());
+    }
+    state.counters["nb cells"] = static_cast<double>(ca.nb_cells());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ca.nb_cells()));
+}
+
+BENCHMARK_TEMPLATE(BM_ForEachCell_Threads, samurai::Run::Parallel)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEachCell_Threads, samurai::Run::ParallelStatic)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEachCell_Threads, samurai::Run::ParallelTasks)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <array>
 #include <benchmark/benchmark.h>
 #include <experimental/random>
+#include <vector>
 
 #include <xtensor/xfixed.hpp>
 #include <xtensor/xrandom.hpp>
@@ -66,7 +68,8 @@ class MyFixture : public ::benchmark::Fixture
         mesh = generate_mesh<dim_>(bound, min_level, max_level);
     }
 
-    void bench(benchmark::State& state)
+    template <class Find>
+    void bench(benchmark::State& state, Find&& find)
     {
         std::size_t found = 0;
         for (auto _ : state)
@@ -74,12 +77,12 @@ class MyFixture : public ::benchmark::Fixture
             for (std::size_t s = 0; s < state.range(0); ++s)
             {
                 auto level = std::experimental::randint(min_level, max_level);
-                std::array<int, dim> coord;
+                xt::xtensor_fixed<int, xt::xshape<dim>> coord;
                 for (auto& c : coord)
                 {
                     c = std::experimental::randint(-bound << level, (bound << level) - 1);
                 }
-                auto out = samurai::find(mesh[level], coord);
+                auto out = find(mesh[level], coord);
                 if (out != -1)
                 {
                     found++;
@@ -90,6 +93,55 @@ class MyFixture : public ::benchmark::Fixture
         state.counters["found"]    = static_cast<double>(found) / state.iterations();
     }
 
+    // find() with the search accelerator of the LevelCellArray
+    void bench(benchmark::State& state)
+    {
+        bench(state,
+              [](const auto& lca, const auto& coord)
+              {
+                  return samurai::find(lca, coord);
+              });
+    }
+
+    // std::lower_bound on the intervals
+    void bench_binary_search(benchmark::State& state)
+    {
+        bench(state,
+              [](const auto& lca, const auto& coord)
+              {
+                  return samurai::detail::find_impl(lca, 0, lca[dim - 1].size(), coord, std::integral_constant<std::size_t, dim - 1>{});
+              });
+    }
+
+    // find_batch() on all the probes of a level at once
+    void bench_batch(benchmark::State& state)
+    {
+        const std::size_t level = max_level;
+        std::vector<xt::xtensor_fixed<int, xt::xshape<dim>>> coords(static_cast<std::size_t>(state.range(0)));
+        for (auto& coord : coords)
+        {
+            for (auto& c : coord)
+            {
+                c = std::experimental::randint(-bound << level, (bound << level) - 1);
+            }
+        }
+
+        std::vector<samurai::default_config::index_t> rows;
+        std::size_t found = 0;
+        for (auto _ : state)
+        {
+            samurai::find_batch(mesh[level], coords, rows);
+            found += static_cast<std::size_t>(std::count_if(rows.begin(),
+                                                            rows.end(),
+                                                            [](auto r)
+                                                            {
+                                                                return r != -1;
+                                                            }));
+        }
+        state.counters["nb cells"] = mesh.nb_cells();
+        state.counters["found"]    = static_cast<double>(found) / state.iterations();
+    }
+
     samurai::CellArray<dim_> mesh;
 };
 
@@ -117,3 +169,38 @@ BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, Search_3D, 3, 1)(benchmark::State& state)
 }
 
 BENCHMARK_REGISTER_F(MyFixture, Search_3D)->DenseRange(1, 10, 1);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, BinarySearch_1D, 1, 1000)(benchmark::State& state)
+{
+    bench_binary_search(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, BinarySearch_1D)->DenseRange(1, 10, 1);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, BinarySearch_2D, 2, 10)(benchmark::State& state)
+{
+    bench_binary_search(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, BinarySearch_2D)->DenseRange(1, 10, 1);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, BinarySearch_3D, 3, 1)(benchmark::State& state)
+{
+    bench_binary_search(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, BinarySearch_3D)->DenseRange(1, 10, 1);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, BatchSearch_2D, 2, 10)(benchmark::State& state)
+{
+    bench_batch(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, BatchSearch_2D)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, BatchSearch_3D, 3, 1)(benchmark::State& state)
+{
+    bench_batch(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, BatchSearch_3D)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -107,6 +107,8 @@ static void BM_SetOPWithOn2(benchmark::State& state)
     }
 }
 
+// The interval layout is given by TInterval (default or compact index type)
+template <class TInterval>
 static void BM_BigDomain(benchmark::State& state)
 {
     constexpr std::size_t dim = 2;
@@ -114,8 +116,8 @@ static void BM_BigDomain(benchmark::State& state)
     samurai::Box<int, dim> box1({0, 0}, {1 << level, 1 << level});
     samurai::Box<int, dim> box2({1, 1}, {(1 << (level - 1)) - 1, (1 << (level - 1)) - 1});
 
-    samurai::LevelCellArray<dim> set1{level, box1};
-    samurai::LevelCellArray<dim> set2{level - 1, box2};
+    samurai::LevelCellArray<dim, TInterval> set1{level, box1};
+    samurai::LevelCellArray<dim, TInterval> set2{level - 1, box2};
 
     std::size_t length = 0;
     for (auto _ : state)
@@ -130,9 +132,28 @@ static void BM_BigDomain(benchmark::State& state)
     }
 }
 
+static void BM_LevelCellArrayFromSubset(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+    std::size_t level         = 12;
+    samurai::Box<int, dim> box1({0, 0}, {1 << level, 1 << level});
+    samurai::Box<int, dim> box2({1, 1}, {(1 << (level - 1)) - 1, (1 << (level - 1)) - 1});
+
+    samurai::LevelCellArray<dim> set1{level, box1};
+    samurai::LevelCellArray<dim> set2{level - 1, box2};
+
+    for (auto _ : state)
+    {
+        samurai::LevelCellArray<dim> lca = samurai::difference(set1, set2).on(level);
+        benchmark::DoNotOptimize(lca);
+    }
+}
+
 BENCHMARK(BM_SetCreation);
 BENCHMARK(BM_SetOP);
 BENCHMARK(BM_SetCreationWithOn);
 BENCHMARK(BM_SetOPWithOn);
 BENCHMARK(BM_SetOPWithOn2);
-BENCHMARK(BM_BigDomain);
+BENCHMARK_TEMPLATE(BM_BigDomain, samurai::default_config::interval_t);
+BENCHMARK_TEMPLATE(BM_BigDomain, samurai::default_config::compact_interval_t);
+BENCHMARK(BM_LevelCellArrayFromSubset);
@@ -243,6 +243,7 @@ int main(int argc, char* argv[])
     while (t != Tf)
     {
         MRadaptation(mr_epsilon, mr_regularity);
+        samurai::load_balance(u);
 
         t += dt;
         if (t > Tf)
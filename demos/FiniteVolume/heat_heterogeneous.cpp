@@ -194,7 +194,7 @@ int main(int argc, char* argv[])
 
         if (explicit_scheme)
         {
-            unp1 = u - dt * diff(u);
+            diff.apply_axpy(unp1, 1., u, -dt); // unp1 = u - dt * diff(u)
         }
         else
         {
@@ -6,11 +6,18 @@
 #ifdef SAMURAI_WITH_OPENMP
 #include <omp.h>
 #endif
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include "cell.hpp"
 #include "mesh_holder.hpp"
 #include "mesh_interval.hpp"
+#include "samurai_config.hpp"
 
 namespace samurai
 {
@@ -29,7 +36,21 @@ namespace samurai
     enum class Run
     {
         Sequential,
-        Parallel
+        Parallel,       ///< chunks of the same number of cells, dynamically scheduled
+        ParallelStatic, ///< one chunk of the same number of cells per thread
+        ParallelTasks,  ///< one OpenMP task per interval
+        ParallelColored ///< as Run::Parallel, but the interface loops never process concurrently two interfaces sharing a cell
+    };
+
+    /**
+     * Mesh intervals of the interface loops that may share a cell, used with Run::ParallelColored.
+     * The mesh intervals in the same row of level (level - row_shift) are processed by the same thread,
+     * and if color_axis > 0, the rows of even and odd coordinate along this axis are processed one after the other.
+     */
+    struct RowColoring
+    {
+        std::size_t row_shift  = 0; ///< 1 for the level jumps: the fine rows of a coarse row share the same coarse cells
+        std::size_t color_axis = 0; ///< direction of the interfaces (along x, two intervals of a row never share a cell)
     };
 
     enum class Get
@@ -127,6 +148,203 @@ namespace samurai
             });
     }
 
+    ///////////////////////////////////////////
+    // balanced parallel loop implementation //
+    ///////////////////////////////////////////
+
+    namespace detail
+    {
+        template <Run run_type>
+        inline std::size_t nb_parallel_chunks()
+        {
+#ifdef SAMURAI_WITH_OPENMP
+            auto nb_threads = static_cast<std::size_t>(omp_get_max_threads());
+#else
+            std::size_t nb_threads = 1;
+#endif
+            return (run_type == Run::ParallelStatic) ? nb_threads : nb_threads * parallel_chunks_per_thread;
+        }
+
+        /**
+         * Splits the x-intervals of @param mesh_intervals into chunks holding the same number of cells
+         * and applies @param f on each piece in parallel.
+         *
+         * The chunk boundaries are aligned on 2 * step from the start of the interval, so a piece starts
+         * on a cell with the same parity as the whole interval (required by the level jump iterators).
+         *
+         * The callback has the signature f(piece, k), where k is the position in @param mesh_intervals
+         * of the mesh interval containing the piece.
+         */
+        template <Run run_type, class MeshIntervalType, class Func>
+        void balanced_for_each_indexed_meshinterval(const std::vector<MeshIntervalType>& mesh_intervals, Func&& f)
+        {
+            using value_t = typename MeshIntervalType::interval_t::value_t;
+
+            // prefix sum of the lengths of the intervals
+            std::vector<std::size_t> prefix(mesh_intervals.size() + 1, 0);
+            for (std::size_t k = 0; k < mesh_intervals.size(); ++k)
+            {
+                const auto& i = mesh_intervals[k].i;
+                prefix[k + 1] = prefix[k] + static_cast<std::size_t>(i.end - i.start);
+            }
+
+            const std::size_t nb_chunks = nb_parallel_chunks<run_type>();
+            const std::size_t length    = prefix.back();
+
+            // first item and offset in this item of the chunk c
+            auto boundary = [&](std::size_t c)
+            {
+                std::size_t pos = length / nb_chunks * c + length % nb_chunks * c / nb_chunks;
+                std::size_t k   = static_cast<std::size_t>(std::upper_bound(prefix.begin(), prefix.end(), pos) - prefix.begin()) - 1;
+                if (k == mesh_intervals.size())
+                {
+                    return std::make_pair(k, std::size_t(0));
+                }
+                auto align = 2 * static_cast<std::size_t>(mesh_intervals[k].i.step);
+                return std::make_pair(k, (pos - prefix[k]) / align * align);
+            };
+
+            auto process_chunk = [&](std::size_t c)
+            {
+                auto [k, first]            = boundary(c);
+                auto [k_last, first_last] = boundary(c + 1);
+                for (; k <= k_last && k < mesh_intervals.size(); ++k, first = 0)
+                {
+                    std::size_t last = (k == k_last) ? first_last : prefix[k + 1] - prefix[k];
+                    if (first < last)
+                    {
+                        MeshIntervalType mesh_interval = mesh_intervals[k];
+                        mesh_interval.i.end            = mesh_interval.i.start + static_cast<value_t>(last);
+                        mesh_interval.i.start += static_cast<value_t>(first);
+                        f(mesh_interval, k);
+                    }
+                }
+            };
+
+            if constexpr (run_type == Run::ParallelStatic)
+            {
+#pragma omp parallel for schedule(static)
+                for (std::size_t c = 0; c < nb_chunks; ++c)
+                {
+                    process_chunk(c);
+                }
+            }
+            else
+            {
+#pragma omp parallel for schedule(dynamic, 1)
+                for (std::size_t c = 0; c < nb_chunks; ++c)
+                {
+                    process_chunk(c);
+                }
+            }
+        }
+
+        template <Run run_type, class MeshIntervalType, class Func>
+        void balanced_for_each_meshinterval(const std::vector<MeshIntervalType>& mesh_intervals, Func&& f)
+        {
+            balanced_for_each_indexed_meshinterval<run_type>(mesh_intervals,
+                                                             [&](auto& mesh_interval, std::size_t)
+                                                             {
+                                                                 f(mesh_interval);
+                                                             });
+        }
+
+        /**
+         * Applies @param f in parallel on groups of @param mesh_intervals that don't share any cell (see RowColoring).
+         * A mesh interval is always processed after the ones preceding it in its group,
+         * so the result doesn't depend on the number of threads.
+         *
+         * The callback has the signature f(mesh_interval, k), where k is the position of the mesh interval in @param mesh_intervals.
+         */
+        template <std::size_t dim, class TInterval, class Func>
+        void colored_for_each_indexed_meshinterval(const std::vector<MeshInterval<dim, TInterval>>& mesh_intervals,
+                                                   const RowColoring& coloring,
+                                                   Func&& f)
+        {
+            using value_t = typename TInterval::value_t;
+            using key_t   = std::array<value_t, dim>; // color, then the rows from the last coordinate
+
+            std::vector<key_t> keys(mesh_intervals.size(), key_t{});
+            if constexpr (dim > 1)
+            {
+                for (std::size_t k = 0; k < mesh_intervals.size(); ++k)
+                {
+                    const auto& index = mesh_intervals[k].index;
+                    keys[k][0]        = (coloring.color_axis > 0) ? (index[coloring.color_axis - 1] & 1) : 0;
+                    for (std::size_t d = 1; d < dim; ++d)
+                    {
+                        keys[k][d] = index[dim - 1 - d] >> coloring.row_shift;
+                    }
+                }
+            }
+
+            std::vector<std::size_t> order(mesh_intervals.size());
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            std::stable_sort(order.begin(),
+                             order.end(),
+                             [&](auto k1, auto k2)
+                             {
+                                 return keys[k1] < keys[k2];
+                             });
+
+            // in 1D, there is a single row whose intervals never share a cell
+            std::vector<std::size_t> group_start;
+            std::size_t first_odd_group = 0;
+            for (std::size_t k = 0; k < order.size(); ++k)
+            {
+                if (dim == 1 || k == 0 || keys[order[k]] != keys[order[k - 1]])
+                {
+                    group_start.push_back(k);
+                }
+                if (keys[order[k]][0] == 0)
+                {
+                    first_odd_group = group_start.size();
+                }
+            }
+            group_start.push_back(order.size());
+
+            auto process_groups = [&](std::size_t first_group, std::size_t last_group)
+            {
+#pragma omp parallel for schedule(dynamic)
+                for (std::size_t g = first_group; g < last_group; ++g)
+                {
+                    for (std::size_t k = group_start[g]; k < group_start[g + 1]; ++k)
+                    {
+                        f(mesh_intervals[order[k]], order[k]);
+                    }
+                }
+            };
+            process_groups(0, first_odd_group);
+            process_groups(first_odd_group, group_start.size() - 1);
+        }
+
+        template <std::size_t dim, class TInterval, class Func>
+        void colored_for_each_meshinterval(const std::vector<MeshInterval<dim, TInterval>>& mesh_intervals, const RowColoring& coloring, Func&& f)
+        {
+            colored_for_each_indexed_meshinterval(mesh_intervals,
+                                                  coloring,
+                                                  [&](const auto& mesh_interval, std::size_t)
+                                                  {
+                                                      f(mesh_interval);
+                                                  });
+        }
+
+        template <class MeshIntervalType, class SetType>
+        auto collect_meshintervals(SetType& set)
+        {
+            std::vector<MeshIntervalType> mesh_intervals;
+            set(
+                [&](const auto& i, const auto& index)
+                {
+                    MeshIntervalType mesh_interval(set.level());
+                    mesh_interval.i     = i;
+                    mesh_interval.index = index;
+                    mesh_intervals.push_back(mesh_interval);
+                });
+            return mesh_intervals;
+        }
+    }
+
     //////////////////////////////////////////
     // for_each_meshinterval implementation //
     //////////////////////////////////////////
@@ -168,7 +386,7 @@ namespace samurai
     }
 
     template <class MeshIntervalType, class SetType, class Func>
-    inline void parallel_for_each_meshinterval(SetType& set, Func&& f)
+    inline void task_for_each_meshinterval(SetType& set, Func&& f)
     {
 #pragma omp parallel
 #pragma omp single nowait
@@ -185,12 +403,33 @@ namespace samurai
             });
     }
 
+    template <class MeshIntervalType, Run run_type = Run::Parallel, class SetType, class Func>
+    inline void parallel_for_each_meshinterval(SetType& set, Func&& f)
+    {
+        if constexpr (run_type == Run::ParallelTasks)
+        {
+            task_for_each_meshinterval<MeshIntervalType>(set, std::forward<Func>(f));
+        }
+        else
+        {
+            auto mesh_intervals = detail::collect_meshintervals<MeshIntervalType>(set);
+            detail::balanced_for_each_meshinterval<run_type>(mesh_intervals, std::forward<Func>(f));
+        }
+    }
+
+    template <class MeshIntervalType, class SetType, class Func>
+    inline void colored_for_each_meshinterval(SetType& set, const RowColoring& coloring, Func&& f)
+    {
+        auto mesh_intervals = detail::collect_meshintervals<MeshIntervalType>(set);
+        detail::colored_for_each_meshinterval(mesh_intervals, coloring, std::forward<Func>(f));
+    }
+
     template <class MeshIntervalType, Run run_type, class SetType, class Func>
     inline void for_each_meshinterval(SetType& set, Func&& f)
     {
-        if constexpr (run_type == Run::Parallel)
+        if constexpr (run_type != Run::Sequential)
         {
-            parallel_for_each_meshinterval<MeshIntervalType>(set, std::forward<Func>(f));
+            parallel_for_each_meshinterval<MeshIntervalType, run_type>(set, std::forward<Func>(f));
         }
         else
         {
@@ -198,6 +437,19 @@ namespace samurai
         }
     }
 
+    template <class MeshIntervalType, Run run_type, class SetType, class Func>
+    inline void for_each_meshinterval(SetType& set, [[maybe_unused]] const RowColoring& coloring, Func&& f)
+    {
+        if constexpr (run_type == Run::ParallelColored)
+        {
+            colored_for_each_meshinterval<MeshIntervalType>(set, coloring, std::forward<Func>(f));
+        }
+        else
+        {
+            for_each_meshinterval<MeshIntervalType, run_type>(set, std::forward<Func>(f));
+        }
+    }
+
     //////////////////////////////////
     // for_each_cell implementation //
     //////////////////////////////////
@@ -226,7 +478,7 @@ namespace samurai
     }
 
     template <std::size_t dim, class TInterval, class Func>
-    inline void parallel_for_each_cell(const LevelCellArray<dim, TInterval>& lca, Func&& f)
+    inline void task_for_each_cell(const LevelCellArray<dim, TInterval>& lca, Func&& f)
     {
         using cell_t        = Cell<dim, TInterval>;
         using index_value_t = typename cell_t::value_t;
@@ -252,12 +504,92 @@ namespace samurai
         }
     }
 
+    namespace detail
+    {
+        template <Run run_type, std::size_t dim, class TInterval, class Func>
+        void balanced_for_each_cell(const std::vector<MeshInterval<dim, TInterval>>& mesh_intervals, Func&& f)
+        {
+            using cell_t        = Cell<dim, TInterval>;
+            using index_value_t = typename cell_t::value_t;
+
+            balanced_for_each_meshinterval<run_type>(mesh_intervals,
+                                                     [&](const auto& mesh_interval)
+                                                     {
+                                                         typename cell_t::indices_t index;
+                                                         for (std::size_t d = 0; d < dim - 1; ++d)
+                                                         {
+                                                             index[d + 1] = mesh_interval.index[d];
+                                                         }
+                                                         const auto& interval = mesh_interval.i;
+                                                         for (index_value_t i = interval.start; i < interval.end; ++i)
+                                                         {
+                                                             index[0] = i;
+                                                             cell_t cell{mesh_interval.level, index, interval.index + i};
+                                                             f(cell);
+                                                         }
+                                                     });
+        }
+    }
+
+    template <Run run_type = Run::Parallel, std::size_t dim, class TInterval, class Func>
+    inline void parallel_for_each_cell(const LevelCellArray<dim, TInterval>& lca, Func&& f)
+    {
+        if constexpr (run_type == Run::ParallelTasks)
+        {
+            task_for_each_cell(lca, std::forward<Func>(f));
+        }
+        else
+        {
+            using mesh_interval_t = typename LevelCellArray<dim, TInterval>::mesh_interval_t;
+
+            std::vector<mesh_interval_t> mesh_intervals;
+            mesh_intervals.reserve(lca.nb_intervals());
+            for (auto it = lca.cbegin(); it != lca.cend(); ++it)
+            {
+                mesh_intervals.emplace_back(lca.level(), *it, it.index());
+            }
+            detail::balanced_for_each_cell<run_type>(mesh_intervals, std::forward<Func>(f));
+        }
+    }
+
+    template <Run run_type = Run::Parallel, std::size_t dim, class TInterval, std::size_t max_size, class Func>
+    inline void parallel_for_each_cell(const CellArray<dim, TInterval, max_size>& ca, Func&& f)
+    {
+        if constexpr (run_type == Run::ParallelTasks)
+        {
+            for (std::size_t level = ca.min_level(); level <= ca.max_level(); ++level)
+            {
+                if (!ca[level].empty())
+                {
+                    task_for_each_cell(ca[level], std::forward<Func>(f));
+                }
+            }
+        }
+        else
+        {
+            // the chunks are balanced over all the levels at once
+            using mesh_interval_t = typename LevelCellArray<dim, TInterval>::mesh_interval_t;
+
+            std::vector<mesh_interval_t> mesh_intervals;
+            for (std::size_t level = ca.min_level(); level <= ca.max_level(); ++level)
+            {
+                const auto& lca = ca[level];
+                mesh_intervals.reserve(mesh_intervals.size() + lca.nb_intervals());
+                for (auto it = lca.cbegin(); it != lca.cend(); ++it)
+                {
+                    mesh_intervals.emplace_back(level, *it, it.index());
+                }
+            }
+            detail::balanced_for_each_cell<run_type>(mesh_intervals, std::forward<Func>(f));
+        }
+    }
+
     template <Run run_type, std::size_t dim, class TInterval, class Func>
     inline void for_each_cell(const LevelCellArray<dim, TInterval>& lca, Func&& f)
     {
-        if constexpr (run_type == Run::Parallel)
+        if constexpr (run_type != Run::Sequential)
         {
-            parallel_for_each_cell(lca, std::forward<Func>(f));
+            parallel_for_each_cell<run_type>(lca, std::forward<Func>(f));
         }
         else
         {
@@ -290,11 +622,18 @@ namespace samurai
     template <Run run_type, std::size_t dim, class TInterval, std::size_t max_size, class Func>
     inline void for_each_cell(const CellArray<dim, TInterval, max_size>& ca, Func&& f)
     {
-        for (std::size_t level = ca.min_level(); level <= ca.max_level(); ++level)
+        if constexpr (run_type != Run::Sequential)
         {
-            if (!ca[level].empty())
+            parallel_for_each_cell<run_type>(ca, std::forward<Func>(f));
+        }
+        else
+        {
+            for (std::size_t level = ca.min_level(); level <= ca.max_level(); ++level)
             {
-                for_each_cell<run_type>(ca[level], std::forward<Func>(f));
+                if (!ca[level].empty())
+                {
+                    for_each_cell(ca[level], std::forward<Func>(f));
+                }
             }
         }
     }
@@ -427,12 +766,274 @@ namespace samurai
             }
             return find_index;
         }
+
+        template <std::size_t dim, class TInterval, class Search, class index_t = typename TInterval::index_t, class coord_index_t = typename TInterval::coord_index_t>
+        inline auto find_impl(const LevelCellArray<dim, TInterval>&,
+                              const Search& search,
+                              std::size_t start_index,
+                              std::size_t end_index,
+                              const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord,
+                              std::integral_constant<std::size_t, 0>) -> index_t
+        {
+            return static_cast<index_t>(search.find(0, start_index, end_index, coord[0]));
+        }
+
+        template <std::size_t dim,
+                  class TInterval,
+                  class Search,
+                  class index_t       = typename TInterval::index_t,
+                  class coord_index_t = typename TInterval::coord_index_t,
+                  std::size_t N>
+        inline auto find_impl(const LevelCellArray<dim, TInterval>& lca,
+                              const Search& search,
+                              std::size_t start_index,
+                              std::size_t end_index,
+                              const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord,
+                              std::integral_constant<std::size_t, N>) -> index_t
+        {
+            auto pos = search.find(N, start_index, end_index, coord[N]);
+            if (pos == -1)
+            {
+                return -1;
+            }
+
+            auto off_ind = static_cast<std::size_t>(lca[N][static_cast<std::size_t>(pos)].index + coord[N]);
+            return find_impl(lca,
+                             search,
+                             lca.offsets(N)[off_ind],
+                             lca.offsets(N)[off_ind + 1],
+                             coord,
+                             std::integral_constant<std::size_t, N - 1>{});
+        }
     } // namespace detail
 
     template <std::size_t dim, class TInterval, class index_t = typename TInterval::index_t, class coord_index_t = typename TInterval::coord_index_t>
     inline auto find(const LevelCellArray<dim, TInterval>& lca, const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord) -> index_t
     {
-        return detail::find_impl(lca, 0, lca[dim - 1].size(), coord, std::integral_constant<std::size_t, dim - 1>{});
+        if constexpr (enable_search_accelerator)
+        {
+            return detail::find_impl(lca,
+                                     lca.search_accelerator(),
+                                     0,
+                                     lca[dim - 1].size(),
+                                     coord,
+                                     std::integral_constant<std::size_t, dim - 1>{});
+        }
+        else
+        {
+            return detail::find_impl(lca, 0, lca[dim - 1].size(), coord, std::integral_constant<std::size_t, dim - 1>{});
+        }
+    }
+
+    namespace detail
+    {
+        /**
+         * Order of the queries sorted in lexicographic order (the last
+         * coordinate being the most significant).
+         *
+         * When the bounding box of the coordinates fits in 64 bits, the
+         * coordinates are packed in a key which is sorted with a radix sort.
+         */
+        template <std::size_t dim, class Coords>
+        std::vector<std::size_t> sort_queries(const Coords& coords)
+        {
+            using key_t = std::pair<std::uint64_t, std::size_t>;
+
+            // Number of bits of a radix digit
+            constexpr std::size_t radix_bits = 8;
+            constexpr std::size_t radix_size = std::size_t{1} << radix_bits;
+
+            const std::size_t n = coords.size();
+
+            std::array<std::int64_t, dim> min;
+            std::array<std::int64_t, dim> max;
+            min.fill(std::numeric_limits<std::int64_t>::max());
+            max.fill(std::numeric_limits<std::int64_t>::min());
+            for (std::size_t q = 0; q < n; ++q)
+            {
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    min[d] = std::min(min[d], static_cast<std::int64_t>(coords[q][d]));
+                    max[d] = std::max(max[d], static_cast<std::int64_t>(coords[q][d]));
+                }
+            }
+
+            std::array<std::size_t, dim> shift;
+            std::size_t nbits = 0;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                shift[d]   = nbits;
+                auto range = static_cast<std::uint64_t>(max[d] - min[d]);
+                while (range != 0 && nbits <= 64)
+                {
+                    range >>= 1;
+                    ++nbits;
+                }
+            }
+
+            std::vector<std::size_t> order(n);
+            std::iota(order.begin(), order.end(), 0);
+
+            if (nbits > 64)
+            {
+                auto less = [&](std::size_t q1, std::size_t q2)
+                {
+                    for (std::size_t d = dim; d-- > 0;)
+                    {
+                        if (coords[q1][d] != coords[q2][d])
+                        {
+                            return coords[q1][d] < coords[q2][d];
+                        }
+                    }
+                    return false;
+                };
+                if (!std::is_sorted(order.begin(), order.end(), less))
+                {
+                    std::sort(order.begin(), order.end(), less);
+                }
+                return order;
+            }
+
+            std::vector<key_t> keys(n);
+            for (std::size_t q = 0; q < n; ++q)
+            {
+                std::uint64_t key = 0;
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    // shift[d] can be 64 only if the coordinates are all equal along d
+                    const auto value = static_cast<std::uint64_t>(static_cast<std::int64_t>(coords[q][d]) - min[d]);
+                    key |= (value == 0) ? 0 : value << shift[d];
+                }
+                keys[q] = {key, q};
+            }
+            if (std::is_sorted(keys.begin(), keys.end()))
+            {
+                return order;
+            }
+
+            // LSD radix sort: each pass is stable
+            std::vector<key_t> tmp(n);
+            for (std::size_t bit = 0; bit < nbits; bit += radix_bits)
+            {
+                std::array<std::size_t, radix_size + 1> count{};
+                for (const auto& k : keys)
+                {
+                    ++count[((k.first >> bit) & (radix_size - 1)) + 1];
+                }
+                std::partial_sum(count.begin(), count.end(), count.begin());
+                for (const auto& k : keys)
+                {
+                    tmp[count[(k.first >> bit) & (radix_size - 1)]++] = k;
+                }
+                std::swap(keys, tmp);
+            }
+
+            for (std::size_t q = 0; q < n; ++q)
+            {
+                order[q] = keys[q].second;
+            }
+            return order;
+        }
+    } // namespace detail
+
+    /**
+     * Find the x-intervals containing a batch of coordinates.
+     *
+     * The queries are sorted in lexicographic order (the last coordinate
+     * being the most significant): the search of a (y, z) row is done once for
+     * all the queries in this row and the x-intervals of the row are walked in
+     * increasing order. The sorted queries are split in chunks which can be
+     * handled by several threads.
+     *
+     * @param lca The level cell array where the coordinates are searched.
+     * @param coords A random access container of coordinates (coords[q][d]).
+     * @param rows The position in lca[0] of the interval containing each
+     *             coordinate (-1 if the coordinate is not in lca), as given by
+     *             find().
+     */
+    template <std::size_t dim, class TInterval, class Coords, class index_t = typename TInterval::index_t>
+    inline void find_batch(const LevelCellArray<dim, TInterval>& lca, const Coords& coords, std::vector<index_t>& rows)
+    {
+        using value_t = typename TInterval::value_t;
+
+        // Number of sorted queries handled by one task
+        constexpr std::size_t chunk_size = 4096;
+
+        const std::size_t n = coords.size();
+        rows.assign(n, -1);
+        if (n == 0 || lca.empty())
+        {
+            return;
+        }
+
+        const auto order = detail::sort_queries<dim>(coords);
+
+        const auto& search       = lca.search_accelerator();
+        const std::size_t nchunk = (n + chunk_size - 1) / chunk_size;
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t chunk = 0; chunk < nchunk; ++chunk)
+        {
+            // Range of the intervals to search along each dimension for the current row
+            std::array<std::size_t, dim> range_start;
+            std::array<std::size_t, dim> range_end;
+            std::array<bool, dim> found;
+            range_start[dim - 1] = 0;
+            range_end[dim - 1]   = lca[dim - 1].size();
+            found[dim - 1]       = true;
+
+            std::size_t x_start = range_start[0];
+            std::size_t row_q   = order[chunk * chunk_size]; // first query of the current row
+
+            const std::size_t chunk_end = std::min(n, (chunk + 1) * chunk_size);
+            for (std::size_t iq = chunk * chunk_size; iq < chunk_end; ++iq)
+            {
+                const auto q      = order[iq];
+                const auto& coord = coords[q];
+
+                // Highest dimension where the row changes
+                std::size_t changed = 0;
+                for (std::size_t d = dim - 1; d > 0; --d)
+                {
+                    if (iq == chunk * chunk_size || coord[d] != coords[row_q][d])
+                    {
+                        changed = d;
+                        break;
+                    }
+                }
+
+                for (std::size_t d = changed; d > 0; --d)
+                {
+                    found[d - 1] = false;
+                    if (found[d])
+                    {
+                        auto pos = search.find(d, range_start[d], range_end[d], static_cast<value_t>(coord[d]));
+                        if (pos != -1)
+                        {
+                            auto off_ind       = static_cast<std::size_t>(lca[d][static_cast<std::size_t>(pos)].index + coord[d]);
+                            range_start[d - 1] = lca.offsets(d)[off_ind];
+                            range_end[d - 1]   = lca.offsets(d)[off_ind + 1];
+                            found[d - 1]       = true;
+                        }
+                    }
+                }
+                if (changed > 0 || iq == chunk * chunk_size)
+                {
+                    row_q   = q;
+                    x_start = range_start[0];
+                }
+
+                if (found[0])
+                {
+                    // The queries of a row are sorted: the search starts from the previous result
+                    x_start = search.lower_bound(0, x_start, range_end[0], static_cast<value_t>(coord[0]));
+                    if (x_start < range_end[0] && search.contains(0, x_start, static_cast<value_t>(coord[0])))
+                    {
+                        rows[q] = static_cast<index_t>(x_start);
+                    }
+                }
+            }
+        }
     }
 
     template <std::size_t dim, class TInterval, class coord_index_t = typename TInterval::coord_index_t, class index_t = typename TInterval::index_t>
@@ -4,9 +4,20 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include <xtensor/xfixed.hpp>
 
+#include "../algorithm.hpp"
 #include "../bc.hpp"
 #include "../mr/operators.hpp"
 #include "../numeric/prediction.hpp"
@@ -86,275 +97,762 @@ namespace samurai
         }
     }
 
-    template <class Field, class... Fields>
-    void update_ghost_mr(Field& field, Fields&... other_fields)
+    namespace detail
     {
-        using mesh_id_t                  = typename Field::mesh_t::mesh_id_t;
-        constexpr std::size_t pred_order = Field::mesh_t::config::prediction_order;
+        /**
+         * Subsets browsed by update_ghost_mr() for a given mesh, stored as lists of mesh intervals.
+         * They only depend on the mesh, so they are computed once per mesh version (see Mesh_base::version())
+         * and replayed by the next ghost updates instead of evaluating the set expressions again.
+         */
+        template <class Mesh>
+        struct GhostUpdatePlan
+        {
+            using mesh_interval_t = typename Mesh::mesh_interval_t;
 
-        auto& mesh = field.mesh();
+            std::size_t min_level = 0;
+            std::size_t max_level = 0;
+            std::vector<std::vector<mesh_interval_t>> projection; ///< [level]: the cells of level-1 projected from level
+            std::vector<std::vector<mesh_interval_t>> prediction; ///< [level]: the ghosts of level predicted from level-1
+        };
+
+        template <class Mesh>
+        GhostUpdatePlan<Mesh> make_ghost_update_plan(const Mesh& mesh)
+        {
+            using mesh_id_t       = typename Mesh::mesh_id_t;
+            using mesh_interval_t = typename Mesh::mesh_interval_t;
+
+            GhostUpdatePlan<Mesh> plan;
 
 #ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        auto min_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].min_level(), mpi::minimum<std::size_t>());
-        auto max_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].max_level(), mpi::maximum<std::size_t>());
+            mpi::communicator world;
+            plan.min_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].min_level(), mpi::minimum<std::size_t>());
+            plan.max_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].max_level(), mpi::maximum<std::size_t>());
 #else
-        auto min_level = mesh[mesh_id_t::reference].min_level();
-        auto max_level = mesh[mesh_id_t::reference].max_level();
+            plan.min_level = mesh[mesh_id_t::reference].min_level();
+            plan.max_level = mesh[mesh_id_t::reference].max_level();
 #endif
+            plan.projection.resize(plan.max_level + 1);
+            plan.prediction.resize(plan.max_level + 1);
 
-        for (std::size_t level = max_level; level > min_level; --level)
+            for (std::size_t level = plan.min_level + 1; level <= plan.max_level; ++level)
+            {
+                auto set_at_levelm1 = intersection(mesh[mesh_id_t::reference][level], mesh[mesh_id_t::proj_cells][level - 1]).on(level - 1);
+                plan.projection[level] = collect_meshintervals<mesh_interval_t>(set_at_levelm1);
+
+                auto expr = intersection(difference(mesh[mesh_id_t::all_cells][level],
+                                                    union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level])),
+                                         mesh.subdomain(),
+                                         mesh[mesh_id_t::all_cells][level - 1])
+                                .on(level);
+                plan.prediction[level] = collect_meshintervals<mesh_interval_t>(expr);
+            }
+            return plan;
+        }
+
+        /**
+         * Returns the ghost update plan of the mesh, built at the first call for each mesh version.
+         * The plans of the last ghost_update_plan_cache_size versions are kept.
+         * With MPI, the construction is collective: since the meshes are created and adapted collectively,
+         * all the ranks find (or miss) the plan of their mesh in the cache at the same call.
+         */
+        template <class Mesh>
+        std::shared_ptr<const GhostUpdatePlan<Mesh>> ghost_update_plan(const Mesh& mesh)
         {
-            update_ghost_subdomains(level, field, other_fields...);
-            update_ghost_periodic(level, field, other_fields...);
+            using plan_t = GhostUpdatePlan<Mesh>;
 
-            auto set_at_levelm1 = intersection(mesh[mesh_id_t::reference][level], mesh[mesh_id_t::proj_cells][level - 1]).on(level - 1);
-            set_at_levelm1.apply_op(variadic_projection(field, other_fields...));
+            if constexpr (ghost_update_plan_cache_size == 0)
+            {
+                return std::make_shared<const plan_t>(make_ghost_update_plan(mesh));
+            }
+            else
+            {
+                static std::mutex mutex;
+                static std::vector<std::pair<std::size_t, std::shared_ptr<const plan_t>>> cache; // the most recent last
+
+                std::lock_guard<std::mutex> lock(mutex);
+                for (const auto& [version, plan] : cache)
+                {
+                    if (version == mesh.version())
+                    {
+                        return plan;
+                    }
+                }
+
+                if (cache.size() == ghost_update_plan_cache_size)
+                {
+                    cache.erase(cache.begin());
+                }
+                auto plan = std::make_shared<const plan_t>(make_ghost_update_plan(mesh));
+                cache.emplace_back(mesh.version(), plan);
+                return plan;
+            }
         }
 
-        if (min_level > 0)
+        /// Applies the field operator @param op on the mesh intervals, in parallel (they are disjoint).
+        template <class MeshIntervalType, class Operator>
+        void apply_op_on_meshintervals(const std::vector<MeshIntervalType>& mesh_intervals, const Operator& op)
         {
-            update_bc(min_level - 1, field, other_fields...);
-            update_ghost_periodic(min_level - 1, field, other_fields...);
-            update_ghost_subdomains(min_level - 1, field, other_fields...);
+            balanced_for_each_meshinterval<Run::Parallel>(mesh_intervals,
+                                                          [&](const auto& mesh_interval)
+                                                          {
+                                                              op(mesh_interval.level, mesh_interval.i, mesh_interval.index);
+                                                          });
         }
-        update_bc(min_level, field, other_fields...);
-        update_ghost_periodic(min_level, field, other_fields...);
-        update_ghost_subdomains(min_level, field, other_fields...);
 
-        for (std::size_t level = min_level + 1; level <= max_level; ++level)
+        /**
+         * Cells exchanged with a neighbouring subdomain at one level, given by their storage indices in the fields.
+         * This rank and the neighbour browse the same cells in the same order, so that the values are sent without any description.
+         */
+        template <class Mesh>
+        struct SubdomainExchangeLists
         {
-            auto expr = intersection(difference(mesh[mesh_id_t::all_cells][level],
-                                                union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level])),
-                                     mesh.subdomain(),
-                                     mesh[mesh_id_t::all_cells][level - 1])
-                            .on(level);
+            using index_t = typename Mesh::index_t;
 
-            expr.apply_op(variadic_prediction<pred_order, false>(field, other_fields...));
-            update_ghost_periodic(level, field, other_fields...);
-            update_ghost_subdomains(level, field, other_fields...);
-            update_bc(level, field, other_fields...);
-        }
-    }
+            int rank = 0;
+            std::vector<index_t> owned;  ///< cells of the subdomain in the halo of the neighbour
+            std::vector<index_t> ghosts; ///< cells of the subdomain of the neighbour in the halo of this subdomain
+        };
 
-    inline void update_ghost_mr()
-    {
-    }
+        /**
+         * Send and receive lists of the exchanges with the neighbouring subdomains, computed once per mesh version
+         * from the subsets browsed by the exchanges.
+         */
+        template <class Mesh>
+        struct SubdomainExchangePlan
+        {
+            /// Level of the exchanges covering all the levels at once
+            static constexpr std::size_t all_levels = std::numeric_limits<std::size_t>::max();
 
-    template <class... T>
-    inline void update_ghost_mr(std::tuple<T...>& fields)
-    {
-        std::apply(
-            [](T&... tupleArgs)
+            std::vector<std::vector<SubdomainExchangeLists<Mesh>>> levels; ///< [level][neighbour having cells at this level]
+            std::vector<SubdomainExchangeLists<Mesh>> merged; ///< [neighbour]: the lists of all the levels, one after the other
+
+            const std::vector<SubdomainExchangeLists<Mesh>>& operator[](std::size_t level) const
             {
-                update_ghost_mr(tupleArgs...);
-            },
-            fields);
-    }
+                static const std::vector<SubdomainExchangeLists<Mesh>> no_exchange;
+                if (level == all_levels)
+                {
+                    return merged;
+                }
+                return level < levels.size() ? levels[level] : no_exchange;
+            }
+        };
 
-    template <class... T>
-    inline void update_ghost_mr(Field_tuple<T...>& fields)
-    {
-        update_ghost_mr(fields.elements());
-    }
+        template <class Mesh>
+        SubdomainExchangePlan<Mesh> make_subdomain_exchange_plan([[maybe_unused]] const Mesh& mesh)
+        {
+            SubdomainExchangePlan<Mesh> plan;
 
-    template <class Field>
-    void update_ghost_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& field)
-    {
 #ifdef SAMURAI_WITH_MPI
-        // static constexpr std::size_t dim = Field::dim;
-        using mesh_t    = typename Field::mesh_t;
-        using value_t   = typename Field::value_type;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        std::vector<mpi::request> req;
+            using mesh_id_t = typename Mesh::mesh_id_t;
+            using index_t   = typename Mesh::index_t;
 
-        auto& mesh = field.mesh();
-        mpi::communicator world;
-        std::vector<std::vector<value_t>> to_send(mesh.mpi_neighbourhood().size());
+            const auto& reference = mesh[mesh_id_t::reference];
+            if (reference.empty())
+            {
+                return plan;
+            }
+            plan.levels.resize(reference.max_level() + 1);
 
-        std::size_t i_neigh = 0;
-        for (auto& neighbour : mesh.mpi_neighbourhood())
+            for (std::size_t level = reference.min_level(); level <= reference.max_level(); ++level)
+            {
+                if (reference[level].empty())
+                {
+                    continue;
+                }
+
+                auto gather_indices = [&](auto& set, std::vector<index_t>& indices)
+                {
+                    set(
+                        [&](const auto& i, const auto& index)
+                        {
+                            const auto& interval = mesh.get_interval(level, i, index);
+                            for (auto x = i.start; x < i.end; ++x)
+                            {
+                                indices.push_back(interval.index + x);
+                            }
+                        });
+                };
+
+                for (const auto& neighbour : mesh.mpi_neighbourhood())
+                {
+                    const auto& neighbour_reference = neighbour.mesh[mesh_id_t::reference];
+                    if (neighbour_reference[level].empty())
+                    {
+                        continue;
+                    }
+
+                    auto& lists = plan.levels[level].emplace_back();
+                    lists.rank  = neighbour.rank;
+
+                    auto out_interface = intersection(reference[level], neighbour_reference[level], mesh.subdomain()).on(level);
+                    gather_indices(out_interface, lists.owned);
+
+                    auto in_interface = intersection(neighbour_reference[level], reference[level], neighbour.mesh.subdomain()).on(level);
+                    gather_indices(in_interface, lists.ghosts);
+                }
+            }
+
+            // the storage indices of the levels don't overlap: the lists of a neighbour are concatenated in the order of the levels
+            for (const auto& neighbour : mesh.mpi_neighbourhood())
+            {
+                SubdomainExchangeLists<Mesh> merged;
+                merged.rank    = neighbour.rank;
+                bool exchanges = false;
+                for (const auto& level_lists : plan.levels)
+                {
+                    for (const auto& lists : level_lists)
+                    {
+                        if (lists.rank == neighbour.rank)
+                        {
+                            merged.owned.insert(merged.owned.end(), lists.owned.begin(), lists.owned.end());
+                            merged.ghosts.insert(merged.ghosts.end(), lists.ghosts.begin(), lists.ghosts.end());
+                            exchanges = true;
+                        }
+                    }
+                }
+                if (exchanges)
+                {
+                    plan.merged.push_back(std::move(merged));
+                }
+            }
+#endif
+            return plan;
+        }
+
+        /**
+         * Returns the exchange plan of the mesh, built at the first call for each mesh version.
+         * The plans of the last ghost_update_plan_cache_size versions are kept.
+         */
+        template <class Mesh>
+        std::shared_ptr<const SubdomainExchangePlan<Mesh>> subdomain_exchange_plan(const Mesh& mesh)
         {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+            using plan_t = SubdomainExchangePlan<Mesh>;
+
+            if constexpr (ghost_update_plan_cache_size == 0)
             {
-                auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                  neighbour.mesh[mesh_id_t::reference][level],
-                                                  mesh.subdomain())
-                                         .on(level);
-                out_interface(
-                    [&](const auto& i, const auto& index)
+                return std::make_shared<const plan_t>(make_subdomain_exchange_plan(mesh));
+            }
+            else
+            {
+                static std::mutex mutex;
+                static std::vector<std::pair<std::size_t, std::shared_ptr<const plan_t>>> cache; // the most recent last
+
+                std::lock_guard<std::mutex> lock(mutex);
+                for (const auto& [version, plan] : cache)
+                {
+                    if (version == mesh.version())
                     {
-                        std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                    });
+                        return plan;
+                    }
+                }
 
-                req.push_back(world.isend(neighbour.rank, neighbour.rank, to_send[i_neigh++]));
+                if (cache.size() == ghost_update_plan_cache_size)
+                {
+                    cache.erase(cache.begin());
+                }
+                auto plan = std::make_shared<const plan_t>(make_subdomain_exchange_plan(mesh));
+                cache.emplace_back(mesh.version(), plan);
+                return plan;
             }
         }
 
-        for (auto& neighbour : mesh.mpi_neighbourhood())
+#ifdef SAMURAI_WITH_MPI
+        /**
+         * Send and receive buffers of the exchanges of one level with the neighbouring subdomains,
+         * with the persistent MPI requests bound to them: the same requests are started at each exchange.
+         * The values are sent as raw arrays of value_t, without serialization.
+         */
+        template <class value_t>
+        class SubdomainExchangeBuffers
         {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+          public:
+
+            static_assert(mpi::is_mpi_datatype<value_t>::value, "The values exchanged between the subdomains must be MPI datatypes");
+
+            /// If @param reverse is true, the ghosts are sent and the cells of the subdomain are received.
+            template <class Lists>
+            SubdomainExchangeBuffers(const Lists& lists, std::size_t values_per_cell, bool reverse);
+            ~SubdomainExchangeBuffers();
+
+            SubdomainExchangeBuffers(const SubdomainExchangeBuffers&)            = delete;
+            SubdomainExchangeBuffers& operator=(const SubdomainExchangeBuffers&) = delete;
+
+            void start();
+            void wait();
+
+            std::vector<std::vector<value_t>> send; ///< [neighbour]
+            std::vector<std::vector<value_t>> recv; ///< [neighbour]
+
+          private:
+
+            std::vector<MPI_Request> m_requests;
+        };
+
+        template <class value_t>
+        template <class Lists>
+        SubdomainExchangeBuffers<value_t>::SubdomainExchangeBuffers(const Lists& lists, std::size_t values_per_cell, bool reverse)
+            : send(lists.size())
+            , recv(lists.size())
+            , m_requests(2 * lists.size(), MPI_REQUEST_NULL)
+        {
+            mpi::communicator world;
+            MPI_Datatype datatype = mpi::get_mpi_datatype(value_t{});
+
+            for (std::size_t k = 0; k < lists.size(); ++k)
             {
-                std::vector<value_t> to_recv;
-                std::ptrdiff_t count = 0;
+                const auto& to_send = reverse ? lists[k].ghosts : lists[k].owned;
+                const auto& to_recv = reverse ? lists[k].owned : lists[k].ghosts;
+                send[k].resize(to_send.size() * values_per_cell);
+                recv[k].resize(to_recv.size() * values_per_cell);
+
+                MPI_Send_init(send[k].data(),
+                              static_cast<int>(send[k].size()),
+                              datatype,
+                              lists[k].rank,
+                              lists[k].rank,
+                              world,
+                              &m_requests[2 * k]);
+                MPI_Recv_init(recv[k].data(),
+                              static_cast<int>(recv[k].size()),
+                              datatype,
+                              lists[k].rank,
+                              world.rank(),
+                              world,
+                              &m_requests[2 * k + 1]);
+            }
+        }
 
-                world.recv(neighbour.rank, world.rank(), to_recv);
-                auto in_interface = intersection(neighbour.mesh[mesh_id_t::reference][level],
-                                                 mesh[mesh_id_t::reference][level],
-                                                 neighbour.mesh.subdomain())
-                                        .on(level);
-                in_interface(
-                    [&](const auto& i, const auto& index)
+        template <class value_t>
+        SubdomainExchangeBuffers<value_t>::~SubdomainExchangeBuffers()
+        {
+            // the buffers kept by the pool can outlive MPI
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if (!finalized)
+            {
+                for (auto& request : m_requests)
+                {
+                    MPI_Request_free(&request);
+                }
+            }
+        }
+
+        template <class value_t>
+        void SubdomainExchangeBuffers<value_t>::start()
+        {
+            MPI_Startall(static_cast<int>(m_requests.size()), m_requests.data());
+        }
+
+        template <class value_t>
+        void SubdomainExchangeBuffers<value_t>::wait()
+        {
+            MPI_Waitall(static_cast<int>(m_requests.size()), m_requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        /**
+         * Buffers of the exchanges kept for reuse, identified by the mesh version, the level, the size of the values of a cell
+         * and the direction of the exchange. As in StoragePool, acquire() takes the buffers out of the pool, so that
+         * the exchanges in flight at the same time never share them, and release() gives them back.
+         * At most subdomain_exchange_max_buffers buffers are kept: the oldest ones are freed first, and those of
+         * the other mesh versions are freed by acquire().
+         */
+        template <class value_t>
+        class SubdomainExchangePool
+        {
+          public:
+
+            using buffers_t = SubdomainExchangeBuffers<value_t>;
+            using key_type  = std::tuple<std::size_t, std::size_t, std::size_t, bool>;
+
+            template <class Lists>
+            std::unique_ptr<buffers_t> acquire(const key_type& key, const Lists& lists)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    // the buffers of the previous meshes are not used anymore
+                    m_buffers.erase(std::remove_if(m_buffers.begin(),
+                                                   m_buffers.end(),
+                                                   [&](const auto& entry)
+                                                   {
+                                                       return std::get<0>(entry.first) != std::get<0>(key);
+                                                   }),
+                                    m_buffers.end());
+
+                    auto it = std::find_if(m_buffers.rbegin(),
+                                           m_buffers.rend(),
+                                           [&](const auto& entry)
+                                           {
+                                               return entry.first == key;
+                                           });
+                    if (it != m_buffers.rend())
                     {
-                        std::copy(to_recv.begin() + count,
-                                  to_recv.begin() + count + static_cast<ptrdiff_t>(i.size()),
-                                  field(level, i, index).begin());
-                        count += static_cast<ptrdiff_t>(i.size());
-                    });
+                        auto buffers = std::move(it->second);
+                        m_buffers.erase(std::next(it).base());
+                        return buffers;
+                    }
+                }
+                return std::make_unique<buffers_t>(lists, std::get<2>(key), std::get<3>(key));
             }
+
+            void release(const key_type& key, std::unique_ptr<buffers_t>&& buffers)
+            {
+                if constexpr (subdomain_exchange_max_buffers > 0)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_buffers.size() == subdomain_exchange_max_buffers)
+                    {
+                        m_buffers.erase(m_buffers.begin());
+                    }
+                    m_buffers.emplace_back(key, std::move(buffers));
+                }
+            }
+
+          private:
+
+            std::mutex m_mutex;
+            std::vector<std::pair<key_type, std::unique_ptr<buffers_t>>> m_buffers;
+        };
+
+        template <class value_t>
+        SubdomainExchangePool<value_t>& subdomain_exchange_pool()
+        {
+            static SubdomainExchangePool<value_t> pool;
+            return pool;
         }
-        mpi::wait_all(req.begin(), req.end());
 #endif
-    }
 
-    template <class Field, class... Fields>
-    void update_ghost_subdomains(std::size_t level, Field& field, Fields&... other_fields)
-    {
-        update_ghost_subdomains(level, field);
-        update_ghost_subdomains(level, other_fields...);
-    }
+        /**
+         * Exchange of the ghosts of one level of fields with the neighbouring subdomains: the values of the subdomain
+         * are gathered in the send buffers and the persistent requests are started by the constructor, the received values
+         * are scattered in the ghosts by finish(). The receptions of all the neighbours are in flight at the same time.
+         *
+         * The values of all the fields (defined on the same mesh) are packed one field after the other in a single message
+         * per neighbour, whatever their value types. With @param level equal to SubdomainExchangePlan::all_levels,
+         * this message covers all the levels.
+         *
+         * With @param reverse, the exchange goes the other way: the ghosts are sent to the subdomains owning them
+         * (used by update_tag_subdomains()).
+         */
+        template <class... Fields>
+        class SubdomainGhostExchange
+        {
+          public:
+
+            static_assert(sizeof...(Fields) > 0, "SubdomainGhostExchange needs at least one field");
+
+            SubdomainGhostExchange(std::size_t level, bool reverse, Fields&... fields);
+
+            void finish();
+
+            /// Combines each received value with the current one by @param op(current, received).
+            template <class Operator>
+            void finish(const Operator& op);
+
+          private:
 
-    template <class Field>
-    void update_ghost_subdomains([[maybe_unused]] Field& field)
-    {
 #ifdef SAMURAI_WITH_MPI
-        using mesh_t    = typename Field::mesh_t;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        mpi::communicator world;
+            using mesh_t    = typename std::tuple_element_t<0, std::tuple<Fields...>>::mesh_t;
+            using pool_t    = SubdomainExchangePool<char>;
+            using buffers_t = typename pool_t::buffers_t;
+
+            /// Number of bytes sent per cell
+            static constexpr std::size_t cell_size = ((Fields::size * sizeof(typename Fields::value_type)) + ...);
+
+            template <class Indices, class Function>
+            void for_each_value(const Indices& indices, Function&& f);
+
+            std::shared_ptr<const SubdomainExchangePlan<mesh_t>> m_plan;
+            typename pool_t::key_type m_key;
+            std::unique_ptr<buffers_t> m_buffers;
+            std::size_t m_level;
+            bool m_reverse;
+            std::tuple<Fields*...> m_fields;
+#endif
+        };
+
+        template <class... Fields>
+        SubdomainGhostExchange<Fields...>::SubdomainGhostExchange([[maybe_unused]] std::size_t level,
+                                                                  [[maybe_unused]] bool reverse,
+                                                                  [[maybe_unused]] Fields&... fields)
+        {
+#ifdef SAMURAI_WITH_MPI
+            const auto& mesh = std::get<0>(std::tie(fields...)).mesh();
+            assert(((fields.mesh().version() == mesh.version()) && ...));
 
-        auto& mesh     = field.mesh();
-        auto min_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].min_level(), mpi::minimum<std::size_t>());
-        auto max_level = mpi::all_reduce(world, mesh[mesh_id_t::reference].max_level(), mpi::maximum<std::size_t>());
+            m_plan    = subdomain_exchange_plan(mesh);
+            m_level   = level;
+            m_reverse = reverse;
+            m_fields  = std::make_tuple(&fields...);
 
-        for (std::size_t level = min_level; level <= max_level; ++level)
+            const auto& lists = (*m_plan)[level];
+            if (lists.empty())
+            {
+                return;
+            }
+
+            m_key     = {mesh.version(), level, cell_size, reverse};
+            m_buffers = subdomain_exchange_pool<char>().acquire(m_key, lists);
+
+            for (std::size_t k = 0; k < lists.size(); ++k)
+            {
+                char* buffer = m_buffers->send[k].data();
+                for_each_value(reverse ? lists[k].ghosts : lists[k].owned,
+                               [&](const auto& value, std::size_t position)
+                               {
+                                   std::memcpy(buffer + position, &value, sizeof(value));
+                               });
+            }
+            m_buffers->start();
+#endif
+        }
+
+        template <class... Fields>
+        void SubdomainGhostExchange<Fields...>::finish()
         {
-            update_ghost_subdomains(level, field);
+            finish(
+                [](auto& value, const auto& received)
+                {
+                    value = received;
+                });
         }
-#endif
-    }
 
-    template <bool out = true, class Field>
-    void update_tag_subdomains([[maybe_unused]] std::size_t level,
-                               [[maybe_unused]] Field& tag,
-                               [[maybe_unused]] bool erase      = false,
-                               [[maybe_unused]] bool in_and_out = false)
-    {
+        template <class... Fields>
+        template <class Operator>
+        void SubdomainGhostExchange<Fields...>::finish([[maybe_unused]] const Operator& op)
+        {
 #ifdef SAMURAI_WITH_MPI
-        //  constexpr std::size_t dim = Field::dim;
-        using mesh_t    = typename Field::mesh_t;
-        using value_t   = typename Field::value_type;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        std::vector<mpi::request> req;
+            if (!m_buffers)
+            {
+                return;
+            }
 
-        auto& mesh = tag.mesh();
-        mpi::communicator world;
-        std::vector<std::vector<value_t>> to_send(mesh.mpi_neighbourhood().size());
+            const auto& lists = (*m_plan)[m_level];
 
-        std::size_t i_neigh = 0;
-        for (auto& neighbour : mesh.mpi_neighbourhood())
-        {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+            m_buffers->wait();
+            for (std::size_t k = 0; k < lists.size(); ++k)
             {
-                if constexpr (out)
-                {
-                    auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                      neighbour.mesh[mesh_id_t::reference][level],
-                                                      mesh.subdomain())
-                                             .on(level);
-                    out_interface(
-                        [&](const auto& i, const auto& index)
-                        {
-                            std::copy(tag(level, i, index).begin(), tag(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                        });
-                }
-                else
+                const char* buffer = m_buffers->recv[k].data();
+                for_each_value(m_reverse ? lists[k].owned : lists[k].ghosts,
+                               [&](auto& value, std::size_t position)
+                               {
+                                   std::decay_t<decltype(value)> received;
+                                   std::memcpy(&received, buffer + position, sizeof(received));
+                                   op(value, received);
+                               });
+            }
+            subdomain_exchange_pool<char>().release(m_key, std::move(m_buffers));
+#endif
+        }
+
+#ifdef SAMURAI_WITH_MPI
+        /// Calls @param f(value, position in the buffer) for the values of all the fields on the cells @param indices.
+        template <class... Fields>
+        template <class Indices, class Function>
+        void SubdomainGhostExchange<Fields...>::for_each_value(const Indices& indices, Function&& f)
+        {
+            std::size_t position = 0;
+            std::apply(
+                [&](auto*... fields)
                 {
-                    auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                      neighbour.mesh[mesh_id_t::reference][level],
-                                                      neighbour.mesh.subdomain())
-                                             .on(level);
-                    out_interface(
-                        [&](const auto& i, const auto& index)
+                    auto field_values = [&](auto& field)
+                    {
+                        using field_t = std::decay_t<decltype(field)>;
+                        for (auto cell_index : indices)
                         {
-                            std::copy(tag(level, i, index).begin(), tag(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                        });
-                }
+                            for (std::size_t c = 0; c < field_t::size; ++c)
+                            {
+                                auto& value = field_value(field, cell_index, c);
+                                f(value, position);
+                                position += sizeof(value);
+                            }
+                        }
+                    };
+                    (field_values(*fields), ...);
+                },
+                m_fields);
+        }
+#endif
+    }
 
-                req.push_back(world.isend(neighbour.rank, neighbour.rank, to_send[i_neigh++]));
+    /**
+     * Last exchange of the ghosts of the subdomain boundaries started by begin_ghost_exchange(), completed by end_ghost_exchange().
+     */
+    template <class... Fields>
+    class GhostExchange
+    {
+      public:
+
+        GhostExchange(std::size_t level, bool update_bc_after, Fields&... fields)
+            : m_level(level)
+            , m_update_bc_after(update_bc_after)
+            , m_fields(fields...)
+            , m_exchange(level, false, fields...)
+        {
+        }
+
+        GhostExchange(const GhostExchange&)            = delete;
+        GhostExchange& operator=(const GhostExchange&) = delete;
+        GhostExchange(GhostExchange&&)                 = default;
+        GhostExchange& operator=(GhostExchange&&)      = delete;
+
+        void finish()
+        {
+            m_exchange.finish();
+            if (m_update_bc_after)
+            {
+                std::apply(
+                    [&](auto&... fields)
+                    {
+                        update_bc(m_level, fields...);
+                    },
+                    m_fields);
             }
+            m_update_bc_after = false;
         }
 
-        for (auto& neighbour : mesh.mpi_neighbourhood())
-        {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
-            {
-                std::vector<value_t> to_recv;
-                std::ptrdiff_t count = 0;
+      private:
+
+        std::size_t m_level;
+        bool m_update_bc_after;
+        std::tuple<Fields&...> m_fields;
+        detail::SubdomainGhostExchange<Fields...> m_exchange;
+    };
+
+    /**
+     * Split-phase version of update_ghost_mr(): all the ghosts are updated, except those of the finest level received
+     * from the neighbouring subdomains (and the boundary ghosts of that level, which can depend on them).
+     * Their exchange is in flight when this function returns, and is completed by end_ghost_exchange().
+     * In the meantime, the values outside the halo of the subdomain at the finest level can be used
+     * (see ExplicitFVScheme::apply_with_ghost_exchange()).
+     * Without neighbouring subdomain, nothing is in flight: all the ghosts are updated when this function returns.
+     */
+    template <class Field, class... Fields>
+    GhostExchange<Field, Fields...> begin_ghost_exchange(Field& field, Fields&... other_fields)
+    {
+        constexpr std::size_t pred_order = Field::mesh_t::config::prediction_order;
+
+        auto plan      = detail::ghost_update_plan(field.mesh());
+        auto min_level = plan->min_level;
+        auto max_level = plan->max_level;
+
+        for (std::size_t level = max_level; level > min_level; --level)
+        {
+            update_ghost_subdomains(level, field, other_fields...);
+            update_ghost_periodic(level, field, other_fields...);
+
+            detail::apply_op_on_meshintervals(plan->projection[level], variadic_projection(field, other_fields...));
+        }
+
+        if (min_level > 0)
+        {
+            update_bc(min_level - 1, field, other_fields...);
+            update_ghost_periodic(min_level - 1, field, other_fields...);
+            update_ghost_subdomains(min_level - 1, field, other_fields...);
+        }
+        update_bc(min_level, field, other_fields...);
+        update_ghost_periodic(min_level, field, other_fields...);
+        if (min_level == max_level)
+        {
+            return GhostExchange<Field, Fields...>(min_level, false, field, other_fields...);
+        }
+        update_ghost_subdomains(min_level, field, other_fields...);
+
+        for (std::size_t level = min_level + 1; level < max_level; ++level)
+        {
+            detail::apply_op_on_meshintervals(plan->prediction[level], variadic_prediction<pred_order, false>(field, other_fields...));
+            update_ghost_periodic(level, field, other_fields...);
+            update_ghost_subdomains(level, field, other_fields...);
+            update_bc(level, field, other_fields...);
+        }
+
+        detail::apply_op_on_meshintervals(plan->prediction[max_level], variadic_prediction<pred_order, false>(field, other_fields...));
+        update_ghost_periodic(max_level, field, other_fields...);
+        if (field.mesh().mpi_neighbourhood().empty())
+        {
+            // nothing to wait for: the intervals along the domain boundary may be computed before end_ghost_exchange()
+            update_bc(max_level, field, other_fields...);
+            return GhostExchange<Field, Fields...>(max_level, false, field, other_fields...);
+        }
+        return GhostExchange<Field, Fields...>(max_level, true, field, other_fields...);
+    }
+
+    template <class... Fields>
+    void end_ghost_exchange(GhostExchange<Fields...>& exchange)
+    {
+        exchange.finish();
+    }
+
+    template <class Field, class... Fields>
+    void update_ghost_mr(Field& field, Fields&... other_fields)
+    {
+        auto exchange = begin_ghost_exchange(field, other_fields...);
+        end_ghost_exchange(exchange);
+    }
+
+    inline void update_ghost_mr()
+    {
+    }
+
+    template <class... T>
+    inline void update_ghost_mr(std::tuple<T...>& fields)
+    {
+        std::apply(
+            [](T&... tupleArgs)
+            {
+                update_ghost_mr(tupleArgs...);
+            },
+            fields);
+    }
+
+    template <class... T>
+    inline void update_ghost_mr(Field_tuple<T...>& fields)
+    {
+        update_ghost_mr(fields.elements());
+    }
+
+    /// The values of all the fields are sent in a single message per neighbour.
+    template <class Field, class... Fields>
+    void update_ghost_subdomains(std::size_t level, Field& field, Fields&... other_fields)
+    {
+        detail::SubdomainGhostExchange<Field, Fields...> exchange(level, false, field, other_fields...);
+        exchange.finish();
+    }
+
+    /// Exchanges the ghosts of all the levels, in a single message per neighbour.
+    template <class Field>
+    void update_ghost_subdomains(Field& field)
+    {
+        using plan_t = detail::SubdomainExchangePlan<typename Field::mesh_t>;
 
-                world.recv(neighbour.rank, world.rank(), to_recv);
+        update_ghost_subdomains(plan_t::all_levels, field);
+    }
 
-                if (out)
+    /**
+     * Exchanges the tags of the cells at the boundary of the subdomains: with @tparam out, the tags of the cells of the subdomain
+     * are sent to the ghosts of the neighbours, otherwise the tags of the ghosts are sent back to the subdomains owning the cells.
+     * The received tags replace the current ones if @param erase is true, and are combined with them by a bitwise or otherwise.
+     */
+    template <bool out = true, class Field>
+    void update_tag_subdomains([[maybe_unused]] std::size_t level,
+                               [[maybe_unused]] Field& tag,
+                               [[maybe_unused]] bool erase      = false,
+                               [[maybe_unused]] bool in_and_out = false)
+    {
+#ifdef SAMURAI_WITH_MPI
+        detail::SubdomainGhostExchange<Field> exchange(level, !out, tag);
+        exchange.finish(
+            [&](auto& value, const auto& received)
+            {
+                if (erase)
                 {
-                    auto in_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                     neighbour.mesh[mesh_id_t::reference][level],
-                                                     neighbour.mesh.subdomain())
-                                            .on(level);
-                    in_interface(
-                        [&](const auto& i, const auto& index)
-                        {
-                            xt::xtensor<value_t, 1> neigh_tag = xt::empty_like(tag(level, i, index));
-                            std::copy(to_recv.begin() + count,
-                                      to_recv.begin() + count + static_cast<std::ptrdiff_t>(i.size()),
-                                      neigh_tag.begin());
-                            if (erase)
-                            {
-                                tag(level, i, index) = neigh_tag;
-                            }
-                            else
-                            {
-                                tag(level, i, index) |= neigh_tag;
-                            }
-                            count += static_cast<std::ptrdiff_t>(i.size());
-                        });
+                    value = received;
                 }
                 else
                 {
-                    auto in_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                     neighbour.mesh[mesh_id_t::reference][level],
-                                                     mesh.subdomain())
-                                            .on(level);
-                    in_interface(
-                        [&](const auto& i, const auto& index)
-                        {
-                            xt::xtensor<value_t, 1> neigh_tag = xt::empty_like(tag(level, i, index));
-                            std::copy(to_recv.begin() + count,
-                                      to_recv.begin() + count + static_cast<std::ptrdiff_t>(i.size()),
-                                      neigh_tag.begin());
-                            if (erase)
-                            {
-                                tag(level, i, index) = neigh_tag;
-                            }
-                            else
-                            {
-                                tag(level, i, index) |= neigh_tag;
-                            }
-                            count += static_cast<std::ptrdiff_t>(i.size());
-                        });
+                    value |= received;
                 }
-            }
-        }
-        mpi::wait_all(req.begin(), req.end());
-
+            });
 #endif
     }
 
@@ -736,65 +1234,253 @@ namespace samurai
         void update_fields(Mesh&)
         {
         }
-    }
 
-    template <class Tag, class... Fields>
-    bool update_field(Tag& tag, Fields&... fields)
-    {
-        static constexpr std::size_t dim = Tag::dim;
-        using mesh_t                     = typename Tag::mesh_t;
-        using mesh_id_t                  = typename Tag::mesh_t::mesh_id_t;
-        using cl_type                    = typename Tag::mesh_t::cl_type;
+        /**
+         * Check if the tag leaves the cells of the mesh unchanged: all the
+         * cells are kept, except refined cells at the maximum level and
+         * coarsened cells at the minimum level which are also kept.
+         */
+        template <class Tag, class Mesh>
+        bool is_unchanged(const Tag& tag, const Mesh& mesh)
+        {
+            using mesh_id_t = typename Mesh::mesh_id_t;
 
-        auto& mesh = tag.mesh();
+            const auto& cells = mesh[mesh_id_t::cells];
+            for (std::size_t level = cells.min_level(); level <= cells.max_level(); ++level)
+            {
+                for (const auto& interval : cells[level][0])
+                {
+                    for (auto itag = interval.start + interval.index; itag < interval.end + interval.index; ++itag)
+                    {
+                        if (tag[itag] & static_cast<int>(CellFlag::refine))
+                        {
+                            if (level < mesh.max_level())
+                            {
+                                return false;
+                            }
+                        }
+                        else if (!(tag[itag] & static_cast<int>(CellFlag::keep))
+                                 && (!(tag[itag] & static_cast<int>(CellFlag::coarsen)) || level > mesh.min_level()))
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
 
-        cl_type cl;
+        /**
+         * Cells of the adapted mesh gathered in a CellList.
+         */
+        template <class Tag, class Mesh>
+        void adapted_cell_list(const Tag& tag, const Mesh& mesh, typename Mesh::cl_type& cl)
+        {
+            static constexpr std::size_t dim = Mesh::dim;
+            using mesh_id_t                  = typename Mesh::mesh_id_t;
+            using value_t                    = typename Mesh::interval_t::value_t;
 
-        for_each_interval(mesh[mesh_id_t::cells],
-                          [&](std::size_t level, const auto& interval, const auto& index)
-                          {
-                              auto itag = interval.start + interval.index;
-                              for (auto i = interval.start; i < interval.end; ++i)
+            for_each_interval(mesh[mesh_id_t::cells],
+                              [&](std::size_t level, const auto& interval, const auto& index)
                               {
-                                  if (tag[itag] & static_cast<int>(CellFlag::refine))
+                                  auto itag = interval.start + interval.index;
+                                  for (value_t i = interval.start; i < interval.end; ++i)
                                   {
-                                      if (level < mesh.max_level())
+                                      if (tag[itag] & static_cast<int>(CellFlag::refine))
                                       {
-                                          static_nested_loop<dim - 1, 0, 2>(
-                                              [&](const auto& stencil)
-                                              {
-                                                  auto new_index = 2 * index + stencil;
-                                                  cl[level + 1][new_index].add_interval({2 * i, 2 * i + 2});
-                                              });
+                                          if (level < mesh.max_level())
+                                          {
+                                              static_nested_loop<dim - 1, 0, 2>(
+                                                  [&](const auto& stencil)
+                                                  {
+                                                      auto new_index = 2 * index + stencil;
+                                                      cl[level + 1][new_index].add_interval({2 * i, 2 * i + 2});
+                                                  });
+                                          }
+                                          else
+                                          {
+                                              cl[level][index].add_point(i);
+                                          }
                                       }
-                                      else
+                                      else if (tag[itag] & static_cast<int>(CellFlag::keep))
                                       {
                                           cl[level][index].add_point(i);
                                       }
-                                  }
-                                  else if (tag[itag] & static_cast<int>(CellFlag::keep))
-                                  {
-                                      cl[level][index].add_point(i);
-                                  }
-                                  else if (tag[itag] & static_cast<int>(CellFlag::coarsen))
-                                  {
-                                      if (level > mesh.min_level())
-                                      {
-                                          cl[level - 1][index >> 1].add_point(i >> 1);
-                                      }
-                                      else
+                                      else if (tag[itag] & static_cast<int>(CellFlag::coarsen))
                                       {
-                                          cl[level][index].add_point(i);
+                                          if (level > mesh.min_level())
+                                          {
+                                              cl[level - 1][index >> 1].add_point(i >> 1);
+                                          }
+                                          else
+                                          {
+                                              cl[level][index].add_point(i);
+                                          }
                                       }
+                                      itag++;
                                   }
-                                  itag++;
-                              }
-                          });
+                              });
+        }
+
+        /**
+         * Cells of the adapted mesh obtained by patching the levels of the
+         * current mesh where cells are refined or coarsened: the removed cells
+         * are subtracted and the new ones are added with set operations on the
+         * intervals, the unchanged levels are copied.
+         *
+         * Returns false if the proportion of changed cells is above
+         * incremental_update_max_ratio: the mesh must then be rebuilt.
+         */
+        template <class Tag, class Mesh>
+        bool adapted_cell_array(const Tag& tag, const Mesh& mesh, typename Mesh::ca_type& new_cells)
+        {
+            static constexpr std::size_t dim = Mesh::dim;
+            using mesh_id_t                  = typename Mesh::mesh_id_t;
+            using cl_type                    = typename Mesh::cl_type;
+            using lca_type                   = typename Mesh::lca_type;
+            using value_t                    = typename Mesh::interval_t::value_t;
+
+            const auto& cells      = mesh[mesh_id_t::cells];
+            const auto max_changes = static_cast<std::size_t>(incremental_update_max_ratio * static_cast<double>(cells.nb_cells()));
+
+            cl_type removed;
+            cl_type added;
+            std::size_t nb_changes = 0;
+
+            // explicit loop over the intervals to stop as soon as there are too many changes
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                const auto& lca = cells[level];
+                if (lca.empty())
+                {
+                    continue;
+                }
+                for (auto it = lca.cbegin(); it != lca.cend(); ++it)
+                {
+                    const auto& interval = *it;
+                    const auto& index    = it.index();
+                    auto itag            = interval.start + interval.index;
+                    for (value_t i = interval.start; i < interval.end; ++i)
+                    {
+                        if (tag[itag] & static_cast<int>(CellFlag::refine))
+                        {
+                            if (level < mesh.max_level())
+                            {
+                                removed[level][index].add_point(i);
+                                static_nested_loop<dim - 1, 0, 2>(
+                                    [&](const auto& stencil)
+                                    {
+                                        auto new_index = 2 * index + stencil;
+                                        added[level + 1][new_index].add_interval({2 * i, 2 * i + 2});
+                                    });
+                                ++nb_changes;
+                            }
+                        }
+                        else if (!(tag[itag] & static_cast<int>(CellFlag::keep)))
+                        {
+                            if (!(tag[itag] & static_cast<int>(CellFlag::coarsen)))
+                            {
+                                // a cell without flag is removed
+                                removed[level][index].add_point(i);
+                                ++nb_changes;
+                            }
+                            else if (level > mesh.min_level())
+                            {
+                                removed[level][index].add_point(i);
+                                added[level - 1][index >> 1].add_point(i >> 1);
+                                ++nb_changes;
+                            }
+                        }
+                        itag++;
+                    }
+                    if (nb_changes > max_changes)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                const auto& lca = cells[level];
+                lca_type removed_lca(removed[level]);
+                lca_type added_lca(added[level]);
+
+                if (removed_lca.empty())
+                {
+                    if (added_lca.empty())
+                    {
+                        new_cells[level] = lca;
+                    }
+                    else if (lca.empty())
+                    {
+                        new_cells[level] = added_lca;
+                    }
+                    else
+                    {
+                        new_cells[level] = lca_type(union_(lca, added_lca));
+                    }
+                }
+                else if (added_lca.empty())
+                {
+                    new_cells[level] = lca_type(difference(lca, removed_lca));
+                }
+                else
+                {
+                    new_cells[level] = lca_type(union_(difference(lca, removed_lca), added_lca));
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Mesh built from the cells of mesh adapted with tag.
+         *
+         * If the mesh can be constructed from a CellArray and few cells
+         * change, the cells are patched (see adapted_cell_array) instead of
+         * being gathered cell by cell in a CellList.
+         */
+        template <class Tag, class Mesh>
+        Mesh adapted_mesh(const Tag& tag, const Mesh& mesh)
+        {
+            using ca_type = typename Mesh::ca_type;
+            using cl_type = typename Mesh::cl_type;
 
-        mesh_t new_mesh = {cl, mesh};
+            if constexpr (std::is_constructible_v<Mesh, const ca_type&, const Mesh&>)
+            {
+                ca_type new_cells;
+                if (adapted_cell_array(tag, mesh, new_cells))
+                {
+                    return {new_cells, mesh};
+                }
+            }
+
+            cl_type cl;
+            adapted_cell_list(tag, mesh, cl);
+            return {cl, mesh};
+        }
+    }
+
+    template <class Tag, class... Fields>
+    bool update_field(Tag& tag, Fields&... fields)
+    {
+        using mesh_t = typename Tag::mesh_t;
+
+        auto& mesh = tag.mesh();
 
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
+        if (mpi::all_reduce(world, detail::is_unchanged(tag, mesh), std::logical_and()))
+#else
+        if (detail::is_unchanged(tag, mesh))
+#endif
+        {
+            return true;
+        }
+
+        mesh_t new_mesh = detail::adapted_mesh(tag, mesh);
+
+#ifdef SAMURAI_WITH_MPI
         if (mpi::all_reduce(world, mesh == new_mesh, std::logical_and()))
 #else
         if (mesh == new_mesh)
@@ -811,61 +1497,23 @@ namespace samurai
     template <class Tag, class Field, class... Fields>
     bool update_field_mr(const Tag& tag, Field& field, Fields&... other_fields)
     {
-        using mesh_t                     = typename Field::mesh_t;
-        static constexpr std::size_t dim = mesh_t::dim;
-        using mesh_id_t                  = typename Field::mesh_t::mesh_id_t;
-        using interval_t                 = typename mesh_t::interval_t;
-        using value_t                    = typename interval_t::value_t;
-        using cl_type                    = typename Field::mesh_t::cl_type;
+        using mesh_t = typename Field::mesh_t;
 
         auto& mesh = field.mesh();
-        cl_type cl;
 
-        for_each_interval(mesh[mesh_id_t::cells],
-                          [&](std::size_t level, const auto& interval, const auto& index)
-                          {
-                              auto itag = interval.start + interval.index;
-                              for (value_t i = interval.start; i < interval.end; ++i)
-                              {
-                                  if (tag[itag] & static_cast<int>(CellFlag::refine))
-                                  {
-                                      if (level < mesh.max_level())
-                                      {
-                                          static_nested_loop<dim - 1, 0, 2>(
-                                              [&](const auto& stencil)
-                                              {
-                                                  auto new_index = 2 * index + stencil;
-                                                  cl[level + 1][new_index].add_interval({2 * i, 2 * i + 2});
-                                              });
-                                      }
-                                      else
-                                      {
-                                          cl[level][index].add_point(i);
-                                      }
-                                  }
-                                  else if (tag[itag] & static_cast<int>(CellFlag::keep))
-                                  {
-                                      cl[level][index].add_point(i);
-                                  }
-                                  else if (tag[itag] & static_cast<int>(CellFlag::coarsen))
-                                  {
-                                      if (level > mesh.min_level())
-                                      {
-                                          cl[level - 1][index >> 1].add_point(i >> 1);
-                                      }
-                                      else
-                                      {
-                                          cl[level][index].add_point(i);
-                                      }
-                                  }
-                                  itag++;
-                              }
-                          });
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        if (mpi::all_reduce(world, detail::is_unchanged(tag, mesh), std::logical_and()))
+#else
+        if (detail::is_unchanged(tag, mesh))
+#endif
+        {
+            return true;
+        }
 
-        mesh_t new_mesh = {cl, mesh};
+        mesh_t new_mesh = detail::adapted_mesh(tag, mesh);
 
 #ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
         if (mpi::all_reduce(world, mesh == new_mesh, std::logical_and()))
 #else
         if (mesh == new_mesh)
@@ -880,4 +1528,215 @@ namespace samurai
 
         return false;
     }
+
+    namespace detail
+    {
+        /**
+         * Moves the values of @param field on @param new_mesh: the values of the cells kept by the subdomain are copied,
+         * the values of @param cells_to_send are sent to the @param ranks and the ones of @param received_cells are received.
+         */
+        template <class Mesh, class CellArrays, class Field>
+        void transfer_fields([[maybe_unused]] Mesh& new_mesh,
+                             [[maybe_unused]] const std::vector<int>& ranks,
+                             [[maybe_unused]] const CellArrays& cells_to_send,
+                             [[maybe_unused]] const CellArrays& received_cells,
+                             [[maybe_unused]] Field& field)
+        {
+#ifdef SAMURAI_WITH_MPI
+            using mesh_id_t = typename Mesh::mesh_id_t;
+            using value_t   = typename Field::value_type;
+
+            mpi::communicator world;
+            auto& mesh = field.mesh();
+
+            Field new_field("new_f", new_mesh);
+#ifdef SAMURAI_CHECK_NAN
+            new_field.fill(std::nan(""));
+#else
+            new_field.fill(0);
+#endif
+
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto set = intersection(mesh[mesh_id_t::cells][level], new_mesh[mesh_id_t::cells][level]);
+                set.apply_op(copy(new_field, field));
+            }
+
+            std::vector<mpi::request> req;
+            std::vector<std::vector<value_t>> to_send(ranks.size());
+            for (std::size_t i_neigh = 0; i_neigh < ranks.size(); ++i_neigh)
+            {
+                for_each_interval(cells_to_send[i_neigh],
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      auto values = field(level, i, index);
+                                      std::copy(values.begin(), values.end(), std::back_inserter(to_send[i_neigh]));
+                                  });
+                req.push_back(world.isend(ranks[i_neigh], ranks[i_neigh], to_send[i_neigh]));
+            }
+
+            for (std::size_t i_neigh = 0; i_neigh < ranks.size(); ++i_neigh)
+            {
+                std::vector<value_t> to_recv;
+                std::ptrdiff_t count = 0;
+
+                world.recv(ranks[i_neigh], world.rank(), to_recv);
+                for_each_interval(received_cells[i_neigh],
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      auto values = new_field(level, i, index);
+                                      auto size   = static_cast<std::ptrdiff_t>(values.size());
+                                      std::copy(to_recv.begin() + count, to_recv.begin() + count + size, values.begin());
+                                      count += size;
+                                  });
+            }
+            mpi::wait_all(req.begin(), req.end());
+
+            std::swap(field.array(), new_field.array());
+#endif
+        }
+
+        template <class Mesh, class CellArrays, class Field, class... Fields>
+        void transfer_fields(Mesh& new_mesh,
+                             const std::vector<int>& ranks,
+                             const CellArrays& cells_to_send,
+                             const CellArrays& received_cells,
+                             Field& field,
+                             Fields&... other_fields)
+        {
+            transfer_fields(new_mesh, ranks, cells_to_send, received_cells, field);
+            transfer_fields(new_mesh, ranks, cells_to_send, received_cells, other_fields...);
+        }
+    }
+
+    /// Parameters of load_balance(), set by default to the values of samurai_config.hpp
+    struct LoadBalancingOptions
+    {
+        double max_imbalance     = load_balancing_max_imbalance; ///< the cells are migrated above this load imbalance
+        std::size_t n_iterations = load_balancing_iterations;    ///< iterations of the diffusion of the loads
+        std::vector<double> level_weights;                       ///< cost of a cell of each level (1 if not given)
+    };
+
+    /**
+     * Balances the load of the subdomains when the load imbalance (see Mesh_base::load_imbalance())
+     * exceeds options.max_imbalance: cells are migrated between neighbouring subdomains
+     * (see Mesh_base::load_balancing()) or to any rank along the Morton curve (see Mesh_base::space_filling_curve_partition()),
+     * depending on the load_balancing_method of the mesh configuration, with the values of the fields,
+     * then the mesh and its neighbourhood are rebuilt. All the fields defined on the mesh must be given.
+     * This function is collective.
+     *
+     * The level weights of the options are taken into account by the imbalance and the space-filling curve:
+     * the diffusion method moves the cells by blocks of the minimum level and only balances their number.
+     * @return true if cells have been migrated (the mesh and the fields are left untouched otherwise).
+     */
+    template <class Field, class... Fields>
+    bool load_balance([[maybe_unused]] LoadBalancingOptions options,
+                      [[maybe_unused]] Field& field,
+                      [[maybe_unused]] Fields&... other_fields)
+    {
+#ifdef SAMURAI_WITH_MPI
+        using mesh_t    = typename Field::mesh_t;
+        using mesh_id_t = typename mesh_t::mesh_id_t;
+        using ca_type   = typename mesh_t::ca_type;
+        using cl_type   = typename mesh_t::cl_type;
+
+        auto& mesh = field.mesh();
+        if (mesh.load_imbalance(options.level_weights) <= options.max_imbalance)
+        {
+            return false;
+        }
+
+        mpi::communicator world;
+
+        // ranks exchanging cells with the current subdomain and the cells sent to each of them
+        std::vector<int> ranks;
+        std::vector<ca_type> cells_to_send;
+        if constexpr (detail::config_load_balancing_method<typename mesh_t::config>::value == LoadBalancingMethod::space_filling_curve)
+        {
+            cells_to_send = mesh.space_filling_curve_partition(options.level_weights);
+            cells_to_send.erase(cells_to_send.begin() + world.rank());
+            for (int r = 0; r < world.size(); ++r)
+            {
+                if (r != world.rank())
+                {
+                    ranks.push_back(r);
+                }
+            }
+        }
+        else
+        {
+            cells_to_send = mesh.load_balancing(options.n_iterations);
+            for (const auto& neighbour : mesh.mpi_neighbourhood())
+            {
+                ranks.push_back(neighbour.rank);
+            }
+        }
+
+        std::size_t nb_sent = 0;
+        for (const auto& sent : cells_to_send)
+        {
+            nb_sent += sent.nb_cells();
+        }
+        if (mpi::all_reduce(world, nb_sent, std::plus<std::size_t>()) == 0)
+        {
+            return false;
+        }
+
+        std::vector<mpi::request> req;
+        for (std::size_t i_neigh = 0; i_neigh < ranks.size(); ++i_neigh)
+        {
+            req.push_back(world.isend(ranks[i_neigh], ranks[i_neigh], cells_to_send[i_neigh]));
+        }
+        std::vector<ca_type> received_cells(ranks.size());
+        for (std::size_t i_neigh = 0; i_neigh < ranks.size(); ++i_neigh)
+        {
+            world.recv(ranks[i_neigh], world.rank(), received_cells[i_neigh]);
+        }
+        mpi::wait_all(req.begin(), req.end());
+
+        // the cells of the subdomain which are not sent
+        ca_type kept_cells = mesh[mesh_id_t::cells];
+        for (const auto& sent : cells_to_send)
+        {
+            cl_type kept_cl;
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto expr = difference(kept_cells[level], sent[level]);
+                expr(
+                    [&](const auto& i, const auto& index)
+                    {
+                        kept_cl[level][index].add_interval(i);
+                    });
+            }
+            kept_cells = {kept_cl};
+        }
+
+        cl_type cl;
+        auto add_cells = [&](std::size_t level, const auto& i, const auto& index)
+        {
+            cl[level][index].add_interval(i);
+        };
+        for_each_interval(kept_cells, add_cells);
+        for (const auto& received : received_cells)
+        {
+            for_each_interval(received, add_cells);
+        }
+
+        mesh_t new_mesh(cl, mesh);
+        detail::transfer_fields(new_mesh, ranks, cells_to_send, received_cells, field, other_fields...);
+        mesh.swap(new_mesh);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Same as above, with the default options.
+     */
+    template <class Field, class... Fields>
+    bool load_balance(Field& field, Fields&... other_fields)
+    {
+        return load_balance(LoadBalancingOptions{}, field, other_fields...);
+    }
 }
@@ -0,0 +1,233 @@
+// Copyright 2018-2024 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace samurai
+{
+    ///////////////////////////////
+    // MonotonicArena definition //
+    ///////////////////////////////
+
+    /** @class MonotonicArena
+     *  @brief Memory arena where allocations are bump-pointer moves in large blocks.
+     *
+     * Memory is never given back individually: it is freed in bulk by release()
+     * or when the arena is destroyed. The block size grows geometrically so
+     * that filling the arena with n bytes needs O(log n) system allocations.
+     */
+    class MonotonicArena
+    {
+      public:
+
+        explicit MonotonicArena(std::size_t initial_block_size = 4096);
+        ~MonotonicArena();
+
+        MonotonicArena(const MonotonicArena&)            = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        MonotonicArena(MonotonicArena&&)            = delete;
+        MonotonicArena& operator=(MonotonicArena&&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t alignment);
+        void release();
+
+        std::size_t nb_blocks() const;
+        std::size_t capacity() const;
+
+      private:
+
+        struct block_t
+        {
+            std::byte* data;
+            std::size_t size;
+        };
+
+        void new_block(std::size_t min_size);
+
+        std::vector<block_t> m_blocks;
+        std::byte* m_current = nullptr;
+        std::size_t m_left   = 0;
+        std::size_t m_initial_block_size;
+        std::size_t m_next_block_size;
+    };
+
+    ///////////////////////////////////
+    // MonotonicArena implementation //
+    ///////////////////////////////////
+
+    inline MonotonicArena::MonotonicArena(std::size_t initial_block_size)
+        : m_initial_block_size(std::max<std::size_t>(initial_block_size, 64))
+        , m_next_block_size(m_initial_block_size)
+    {
+    }
+
+    inline MonotonicArena::~MonotonicArena()
+    {
+        release();
+    }
+
+    inline void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment)
+    {
+        void* ptr = m_current;
+        if (m_current == nullptr || !std::align(alignment, bytes, ptr, m_left))
+        {
+            new_block(bytes + alignment);
+            ptr = m_current;
+            std::align(alignment, bytes, ptr, m_left);
+        }
+        m_current = static_cast<std::byte*>(ptr) + bytes;
+        m_left -= bytes;
+        return ptr;
+    }
+
+    /// Free all the blocks at once.
+    inline void MonotonicArena::release()
+    {
+        for (auto& block : m_blocks)
+        {
+            ::operator delete(block.data);
+        }
+        m_blocks.clear();
+        m_current         = nullptr;
+        m_left            = 0;
+        m_next_block_size = m_initial_block_size;
+    }
+
+    inline std::size_t MonotonicArena::nb_blocks() const
+    {
+        return m_blocks.size();
+    }
+
+    /// Total number of bytes reserved by the arena.
+    inline std::size_t MonotonicArena::capacity() const
+    {
+        std::size_t size = 0;
+        for (const auto& block : m_blocks)
+        {
+            size += block.size;
+        }
+        return size;
+    }
+
+    inline void MonotonicArena::new_block(std::size_t min_size)
+    {
+        std::size_t size = std::max(m_next_block_size, min_size);
+        auto* data       = static_cast<std::byte*>(::operator new(size));
+        m_blocks.push_back({data, size});
+        m_current         = data;
+        m_left            = size;
+        m_next_block_size = 2 * size;
+    }
+
+    ///////////////////////////////
+    // ArenaAllocator definition //
+    ///////////////////////////////
+
+    /** @class ArenaAllocator
+     *  @brief Allocator drawing its memory from a MonotonicArena.
+     *
+     * A default constructed allocator is not bound to any arena and uses
+     * the global operator new. A copy of a container never shares the arena
+     * of the original one (see select_on_container_copy_construction) so that
+     * it can outlive it.
+     *
+     * @tparam T The allocated type.
+     */
+    template <class T>
+    class ArenaAllocator
+    {
+      public:
+
+        using value_type = T;
+
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        ArenaAllocator() noexcept = default;
+        explicit ArenaAllocator(MonotonicArena* arena) noexcept;
+
+        template <class U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept; // cppcheck-suppress noExplicitConstructor
+
+        T* allocate(std::size_t n);
+        void deallocate(T* ptr, std::size_t n) noexcept;
+
+        ArenaAllocator select_on_container_copy_construction() const noexcept;
+
+        MonotonicArena* arena() const noexcept;
+
+      private:
+
+        MonotonicArena* m_arena = nullptr;
+    };
+
+    ///////////////////////////////////
+    // ArenaAllocator implementation //
+    ///////////////////////////////////
+
+    template <class T>
+    inline ArenaAllocator<T>::ArenaAllocator(MonotonicArena* arena) noexcept
+        : m_arena(arena)
+    {
+    }
+
+    template <class T>
+    template <class U>
+    inline ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : m_arena(other.arena())
+    {
+    }
+
+    template <class T>
+    inline T* ArenaAllocator<T>::allocate(std::size_t n)
+    {
+        if (m_arena)
+        {
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    template <class T>
+    inline void ArenaAllocator<T>::deallocate(T* ptr, std::size_t n) noexcept
+    {
+        // the memory of an arena is only given back in bulk
+        if (!m_arena)
+        {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+    }
+
+    template <class T>
+    inline auto ArenaAllocator<T>::select_on_container_copy_construction() const noexcept -> ArenaAllocator
+    {
+        return {};
+    }
+
+    template <class T>
+    inline MonotonicArena* ArenaAllocator<T>::arena() const noexcept
+    {
+        return m_arena;
+    }
+
+    template <class T, class U>
+    inline bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+    {
+        return lhs.arena() == rhs.arena();
+    }
+
+    template <class T, class U>
+    inline bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+} // namespace samurai
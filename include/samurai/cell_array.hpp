@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <exception>
+#include <numeric>
 
 #include <fmt/color.h>
 #include <fmt/format.h>
@@ -88,7 +90,8 @@ namespace samurai
         using const_reverse_iterator = CellArray_reverse_iterator<const_iterator>;
 
         CellArray();
-        CellArray(const cl_type& cl, bool with_update_index = true);
+        template <CellListBackend backend>
+        CellArray(const CellList<dim, TInterval, max_size, backend>& cl, bool with_update_index = true);
 
         const lca_type& operator[](std::size_t i) const;
         lca_type& operator[](std::size_t i);
@@ -247,8 +250,11 @@ namespace samurai
      * x-intervals must be computed.
      */
     template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline CellArray<dim_, TInterval, max_size_>::CellArray(const cl_type& cl, bool with_update_index)
+    template <CellListBackend backend>
+    inline CellArray<dim_, TInterval, max_size_>::CellArray(const CellList<dim, TInterval, max_size, backend>& cl, bool with_update_index)
     {
+        // The levels are independent
+#pragma omp parallel for schedule(dynamic)
         for (std::size_t level = 0; level <= max_size; ++level)
         {
             m_cells[level] = cl[level];
@@ -410,17 +416,43 @@ namespace samurai
     /**
      * Update the index in the x-intervals allowing to navigate in the
      * Field data structure.
+     *
+     * The cells are stored level by level: the position of the first cell of
+     * each level is given by a prefix sum, then the levels are updated
+     * concurrently.
      */
     template <std::size_t dim_, class TInterval, std::size_t max_size_>
     inline void CellArray<dim_, TInterval, max_size_>::update_index()
     {
-        std::size_t acc_size = 0;
-        for_each_interval(*this,
-                          [&](auto, auto& interval, auto)
-                          {
-                              interval.index = safe_subs<index_t>(acc_size, interval.start);
-                              acc_size += interval.size();
-                          });
+        std::array<std::size_t, max_size + 1> first_index;
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            first_index[level] = m_cells[level].nb_cells();
+        }
+
+        std::exclusive_scan(first_index.begin(), first_index.end(), first_index.begin(), std::size_t{0});
+
+        // An exception can't leave the parallel region: it is thrown afterwards
+        std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            try
+            {
+                m_cells[level].update_index(first_index[level]);
+            }
+            catch (...)
+            {
+#pragma omp critical
+                error = std::current_exception();
+            }
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
     }
 
     template <std::size_t dim_, class TInterval, std::size_t max_size_>
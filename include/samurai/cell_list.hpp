@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <utility>
 
 #include <fmt/color.h>
 
+#include "arena.hpp"
 #include "level_cell_list.hpp"
 #include "samurai_config.hpp"
 
@@ -17,58 +20,152 @@ namespace samurai
     // CellList definition //
     /////////////////////////
 
-    template <std::size_t dim_, class TInterval = default_config::interval_t, std::size_t max_size_ = default_config::max_level>
+    /** @class CellList
+     *  @brief Sparse lists of intervals for each level used to build a CellArray.
+     *
+     * With the map backend, the nodes of each level are allocated in an arena
+     * owned by the CellList: the levels can be filled concurrently and all the
+     * nodes are freed in bulk by clear() or by the destructor.
+     */
+    template <std::size_t dim_,
+              class TInterval          = default_config::interval_t,
+              std::size_t max_size_    = default_config::max_level,
+              CellListBackend backend_ = default_config::cell_list_backend>
     class CellList
     {
       public:
 
         static constexpr auto dim      = dim_;
         static constexpr auto max_size = max_size_;
+        static constexpr auto backend  = backend_;
 
-        using lcl_type = LevelCellList<dim, TInterval>;
+        using lcl_type = LevelCellList<dim, TInterval, backend>;
 
         CellList();
+        CellList(const CellList& other);
+        CellList(CellList&& other);
+
+        CellList& operator=(const CellList& other);
+        CellList& operator=(CellList&& other);
+
+        ~CellList() = default;
 
         const lcl_type& operator[](std::size_t i) const;
         lcl_type& operator[](std::size_t i);
 
+        void clear();
+
         void to_stream(std::ostream& os) const;
 
       private:
 
-        std::array<lcl_type, max_size + 1> m_cells;
+        using cells_t  = std::array<lcl_type, max_size + 1>;
+        using arenas_t = std::array<MonotonicArena, max_size + 1>;
+
+        template <std::size_t... Is>
+        static cells_t make_cells(arenas_t& arenas, std::index_sequence<Is...>);
+
+        // The arenas must be declared before the lists in order to outlive them
+        std::unique_ptr<arenas_t> m_arenas;
+        cells_t m_cells;
     };
 
     /////////////////////////////
     // CellList implementation //
     /////////////////////////////
 
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    template <std::size_t... Is>
+    inline auto CellList<dim_, TInterval, max_size_, backend_>::make_cells(arenas_t& arenas, std::index_sequence<Is...>) -> cells_t
+    {
+        if constexpr (backend == CellListBackend::map)
+        {
+            return {lcl_type(Is, &arenas[Is])...};
+        }
+        else
+        {
+            return {lcl_type(Is)...};
+        }
+    }
+
     /**
      * Default contructor which sets the level for each LevelCellArray.
      */
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline CellList<dim_, TInterval, max_size_>::CellList()
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline CellList<dim_, TInterval, max_size_, backend_>::CellList()
+        : m_arenas(std::make_unique<arenas_t>())
+        , m_cells(make_cells(*m_arenas, std::make_index_sequence<max_size + 1>{}))
     {
-        for (std::size_t level = 0; level <= max_size; ++level)
+    }
+
+    /**
+     * The copy doesn't share the arenas of other: its lists use the global allocator.
+     */
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline CellList<dim_, TInterval, max_size_, backend_>::CellList(const CellList& other)
+        : m_arenas(std::make_unique<arenas_t>())
+        , m_cells(other.m_cells)
+    {
+    }
+
+    /**
+     * The lists of other are moved with their arenas: other is left empty with new arenas.
+     */
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline CellList<dim_, TInterval, max_size_, backend_>::CellList(CellList&& other)
+        : m_arenas(std::exchange(other.m_arenas, std::make_unique<arenas_t>()))
+        , m_cells(std::move(other.m_cells))
+    {
+        other.m_cells = make_cells(*other.m_arenas, std::make_index_sequence<max_size + 1>{});
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline auto CellList<dim_, TInterval, max_size_, backend_>::operator=(const CellList& other) -> CellList&
+    {
+        m_cells = other.m_cells;
+        return *this;
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline auto CellList<dim_, TInterval, max_size_, backend_>::operator=(CellList&& other) -> CellList&
+    {
+        if (this != &other)
         {
-            m_cells[level] = {level};
+            // the nodes of other are taken with their allocator, so the arenas must follow
+            m_cells = std::move(other.m_cells);
+            std::swap(m_arenas, other.m_arenas);
+            other.clear();
         }
+        return *this;
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto CellList<dim_, TInterval, max_size_>::operator[](std::size_t i) const -> const lcl_type&
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline auto CellList<dim_, TInterval, max_size_, backend_>::operator[](std::size_t i) const -> const lcl_type&
     {
         return m_cells[i];
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto CellList<dim_, TInterval, max_size_>::operator[](std::size_t i) -> lcl_type&
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline auto CellList<dim_, TInterval, max_size_, backend_>::operator[](std::size_t i) -> lcl_type&
     {
         return m_cells[i];
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline void CellList<dim_, TInterval, max_size_>::to_stream(std::ostream& os) const
+    /**
+     * Remove all the intervals and give the memory of the arenas back at once.
+     */
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline void CellList<dim_, TInterval, max_size_, backend_>::clear()
+    {
+        m_cells = make_cells(*m_arenas, std::make_index_sequence<max_size + 1>{});
+        for (auto& arena : *m_arenas)
+        {
+            arena.release();
+        }
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline void CellList<dim_, TInterval, max_size_, backend_>::to_stream(std::ostream& os) const
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
@@ -78,8 +175,8 @@ namespace samurai
         }
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline std::ostream& operator<<(std::ostream& out, const CellList<dim_, TInterval, max_size_>& cell_list)
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, CellListBackend backend_>
+    inline std::ostream& operator<<(std::ostream& out, const CellList<dim_, TInterval, max_size_, backend_>& cell_list)
     {
         cell_list.to_stream(out);
         return out;
@@ -25,6 +25,7 @@ namespace fs = std::filesystem;
 // #include "hdf5.hpp"
 #include "mesh_holder.hpp"
 #include "numeric/gauss_legendre.hpp"
+#include "storage_pool.hpp"
 
 namespace samurai
 {
@@ -148,7 +149,7 @@ namespace samurai
 
             void resize()
             {
-                this->derived_cast().m_data.resize({this->derived_cast().mesh().nb_cells()});
+                resize_from_pool(this->derived_cast().m_data, {this->derived_cast().mesh().nb_cells()});
 #ifdef SAMURAI_CHECK_NAN
                 if constexpr (std::is_floating_point_v<value_t>)
                 {
@@ -285,7 +286,7 @@ namespace samurai
 
             void resize()
             {
-                this->derived_cast().m_data.resize({this->derived_cast().mesh().nb_cells(), size});
+                resize_from_pool(this->derived_cast().m_data, {this->derived_cast().mesh().nb_cells(), size});
 #ifdef SAMURAI_CHECK_NAN
                 this->derived_cast().m_data.fill(std::nan(""));
 #endif
@@ -406,7 +407,7 @@ namespace samurai
 
             void resize()
             {
-                this->derived_cast().m_data.resize({size, this->derived_cast().mesh().nb_cells()});
+                resize_from_pool(this->derived_cast().m_data, {size, this->derived_cast().mesh().nb_cells()});
 #ifdef SAMURAI_CHECK_NAN
                 this->derived_cast().m_data.fill(std::nan(""));
 #endif
@@ -457,10 +458,10 @@ namespace samurai
         Field(const Field&);
         Field& operator=(const Field&);
 
-        Field(Field&&) noexcept            = default;
-        Field& operator=(Field&&) noexcept = default;
+        Field(Field&&) noexcept = default;
+        Field& operator=(Field&&) noexcept;
 
-        ~Field() = default;
+        ~Field();
 
         template <class E>
         Field& operator=(const field_expression<E>& e);
@@ -636,12 +637,20 @@ namespace samurai
         *this = e;
     }
 
+    template <class mesh_t, class value_t, std::size_t size_, bool SOA>
+    inline Field<mesh_t, value_t, size_, SOA>::~Field()
+    {
+        // the memory is kept for the next fields of the same size (see StoragePool)
+        release_to_pool(m_data);
+    }
+
     template <class mesh_t, class value_t, std::size_t size_, bool SOA>
     inline Field<mesh_t, value_t, size_, SOA>::Field(const Field& field)
         : inner_mesh_t(field.mesh())
         , m_name(field.m_name)
-        , m_data(field.m_data)
+        , m_data(storage_pool<data_type>().acquire(field.m_data.shape()))
     {
+        m_data = field.m_data;
         copy_bc_from(field);
     }
 
@@ -650,6 +659,7 @@ namespace samurai
     {
         inner_mesh_t::operator=(field.mesh());
         m_name = field.m_name;
+        resize_from_pool(m_data, field.m_data.shape());
         m_data = field.m_data;
 
         bc_container tmp;
@@ -664,6 +674,21 @@ namespace samurai
         return *this;
     }
 
+    template <class mesh_t, class value_t, std::size_t size_, bool SOA>
+    inline auto Field<mesh_t, value_t, size_, SOA>::operator=(Field&& field) noexcept -> Field&
+    {
+        if (this != &field)
+        {
+            inner_mesh_t::operator=(std::move(field));
+            m_name = std::move(field.m_name);
+            // the memory of the replaced data is kept for the next fields of the same size (see StoragePool)
+            release_to_pool(m_data);
+            m_data = std::move(field.m_data);
+            p_bc   = std::move(field.p_bc);
+        }
+        return *this;
+    }
+
     template <class mesh_t, class value_t, std::size_t size_, bool SOA>
     template <class E>
     inline auto Field<mesh_t, value_t, size_, SOA>::operator=(const field_expression<E>& e) -> Field&
@@ -1,9 +1,437 @@
 #pragma once
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
 #include "boundary.hpp"
+#include "samurai_config.hpp"
 #include "stencil.hpp"
 
 namespace samurai
 {
+    /**
+     * Interfaces browsed by the loops below, depending on whether their computational stencil touches
+     * the ghosts of the finest level outside the subdomain, whose exchange may be in flight (see begin_ghost_exchange()).
+     */
+    enum class InterfaceSelection
+    {
+        all,
+        away_from_halo,
+        near_halo
+    };
+
+    namespace detail
+    {
+        enum class InterfaceType
+        {
+            same_level,
+            level_jump_direction,
+            level_jump_opposite_direction,
+            boundary
+        };
+
+        /// Selection of the interfaces browsed by the loops. It is set by the calling thread, outside the parallel regions.
+        inline InterfaceSelection& interface_selection()
+        {
+            static InterfaceSelection selection = InterfaceSelection::all;
+            return selection;
+        }
+
+        /// Sets the selection of the interfaces until the end of the scope.
+        class ScopedInterfaceSelection
+        {
+          public:
+
+            explicit ScopedInterfaceSelection(InterfaceSelection selection)
+                : m_previous(interface_selection())
+            {
+                interface_selection() = selection;
+            }
+
+            ScopedInterfaceSelection(const ScopedInterfaceSelection&)            = delete;
+            ScopedInterfaceSelection& operator=(const ScopedInterfaceSelection&) = delete;
+
+            ~ScopedInterfaceSelection()
+            {
+                interface_selection() = m_previous;
+            }
+
+          private:
+
+            InterfaceSelection m_previous;
+        };
+
+        template <class Mesh, class = void>
+        struct has_mesh_version : std::false_type
+        {
+        };
+
+        template <class Mesh>
+        struct has_mesh_version<Mesh, std::void_t<decltype(std::declval<const Mesh&>().version())>> : std::true_type
+        {
+        };
+
+        /**
+         * Interfaces browsed by one of the loops below, for a given mesh, level, direction and computational stencil:
+         * the mesh intervals of the loop, and for each of them, the interface and stencil cells at the start of the interval.
+         * Replaying a plan avoids the set operations and the searches in the mesh performed by the initialization of the iterators:
+         * the cells of an interval are obtained by translation of its first cells.
+         */
+        template <class Mesh, std::size_t comput_stencil_size>
+        struct InterfacePlan
+        {
+            using mesh_interval_t = typename Mesh::mesh_interval_t;
+            using cell_t          = Cell<Mesh::dim, typename Mesh::interval_t>;
+
+            std::vector<mesh_interval_t> mesh_intervals;
+            std::vector<std::array<cell_t, 2>> interface_cells;
+            std::vector<std::array<cell_t, comput_stencil_size>> comput_cells;
+            std::vector<bool> near_halo; ///< whether the stencil of the interval touches the halo (see mark_near_halo())
+            RowColoring coloring;
+
+            /// Mesh intervals of the plan selected by an InterfaceSelection, with their positions in the plan
+            struct Selection
+            {
+                std::vector<mesh_interval_t> mesh_intervals;
+                std::vector<std::size_t> positions;
+            };
+
+            // Built by split_near_halo(): both are empty if no interval is near the halo
+            Selection away_from_halo_selection;
+            Selection near_halo_selection;
+
+            template <class Set, class InterfaceIterator, class ComputIterator>
+            void record(Set& set, InterfaceIterator& interface_it, ComputIterator& comput_stencil_it)
+            {
+                mesh_intervals = collect_meshintervals<mesh_interval_t>(set);
+                interface_cells.reserve(mesh_intervals.size());
+                comput_cells.reserve(mesh_intervals.size());
+                for (const auto& mesh_interval : mesh_intervals)
+                {
+                    // the level jump iterators are initialized from the stencil iterator
+                    comput_stencil_it.init(mesh_interval);
+                    interface_it.init(mesh_interval);
+                    interface_cells.push_back(interface_it.cells());
+                    comput_cells.push_back(comput_stencil_it.cells());
+                }
+            }
+
+            /**
+             * Marks the intervals whose computational stencil touches the halo of the subdomain: the reference cells
+             * of the level left in flight by begin_ghost_exchange() outside the subdomain, received from the neighbours
+             * or given by the boundary conditions at the end of the ghost update. Without MPI, begin_ghost_exchange()
+             * doesn't leave any ghost in flight and no interval is marked.
+             */
+            void mark_near_halo([[maybe_unused]] const Mesh& mesh)
+            {
+                near_halo.assign(mesh_intervals.size(), false);
+#ifdef SAMURAI_WITH_MPI
+                using mesh_id_t  = typename Mesh::mesh_id_t;
+                using value_t    = typename Mesh::interval_t::value_t;
+                using row_t      = std::array<value_t, Mesh::dim - 1>;
+                using interval_t = typename Mesh::interval_t;
+
+                // begin_ghost_exchange() defers the finest level of the reference cells of all the ranks. When the local
+                // finest level is below it, the deferred level has no local cell: marking the local finest level is
+                // then only conservative, and it needs no collective communication.
+                std::size_t max_level = mesh[mesh_id_t::reference].max_level();
+
+                std::map<row_t, std::vector<interval_t>> halo;
+                auto halo_set = difference(mesh[mesh_id_t::reference][max_level], mesh.subdomain()).on(max_level);
+                halo_set(
+                    [&](const auto& i, const auto& index)
+                    {
+                        row_t row;
+                        std::copy(index.begin(), index.end(), row.begin());
+                        halo[row].push_back(i);
+                    });
+
+                auto touches_halo = [&](const cell_t& first_cell, std::size_t size)
+                {
+                    row_t row;
+                    std::copy(first_cell.indices.begin() + 1, first_cell.indices.end(), row.begin());
+                    auto it = halo.find(row);
+                    if (it == halo.end())
+                    {
+                        return false;
+                    }
+                    value_t start = first_cell.indices[0];
+                    value_t end   = start + static_cast<value_t>(size);
+                    // the intervals of a row are sorted and disjoint: the first one ending after start is the only candidate
+                    auto interval = std::upper_bound(it->second.begin(),
+                                                     it->second.end(),
+                                                     start,
+                                                     [](value_t value, const interval_t& halo_interval)
+                                                     {
+                                                         return value < halo_interval.end;
+                                                     });
+                    return interval != it->second.end() && interval->start < end;
+                };
+
+                for (std::size_t k = 0; k < mesh_intervals.size(); ++k)
+                {
+                    if (mesh_intervals[k].level != max_level)
+                    {
+                        continue;
+                    }
+                    near_halo[k] = std::any_of(comput_cells[k].begin(),
+                                               comput_cells[k].end(),
+                                               [&](const auto& cell)
+                                               {
+                                                   return touches_halo(cell, mesh_intervals[k].i.size());
+                                               });
+                }
+#endif
+                split_near_halo();
+            }
+
+            /**
+             * Gathers the mesh intervals away from the halo and those near the halo, so that the loops restricted
+             * to one of them (see for_each_planned_meshinterval()) don't select them again at each call.
+             */
+            void split_near_halo()
+            {
+                away_from_halo_selection = {};
+                near_halo_selection      = {};
+                if (std::none_of(near_halo.begin(), near_halo.end(), [](bool near) { return near; }))
+                {
+                    return;
+                }
+                for (std::size_t k = 0; k < mesh_intervals.size(); ++k)
+                {
+                    auto& selection = near_halo[k] ? near_halo_selection : away_from_halo_selection;
+                    selection.mesh_intervals.push_back(mesh_intervals[k]);
+                    selection.positions.push_back(k);
+                }
+            }
+        };
+
+        template <InterfaceType interface_type, class Mesh, std::size_t comput_stencil_size>
+        auto make_interface_plan(const Mesh& mesh,
+                                 std::size_t level,
+                                 const DirectionVector<Mesh::dim>& direction,
+                                 const Stencil<comput_stencil_size, Mesh::dim>& comput_stencil)
+        {
+            static constexpr std::size_t dim = Mesh::dim;
+            using mesh_id_t                  = typename Mesh::mesh_id_t;
+
+            InterfacePlan<Mesh, comput_stencil_size> plan;
+
+            if constexpr (interface_type == InterfaceType::same_level)
+            {
+                auto interface_it      = make_stencil_iterator(mesh, in_out_stencil<dim>(direction));
+                auto comput_stencil_it = make_stencil_iterator(mesh, comput_stencil);
+
+                auto& cells        = mesh[mesh_id_t::cells][level];
+                auto shifted_cells = translate(cells, -direction);
+                auto intersect     = intersection(cells, shifted_cells);
+                plan.record(intersect, interface_it, comput_stencil_it);
+
+                // the interfaces of two consecutive rows in the direction share a cell
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    if (direction[d] != 0)
+                    {
+                        plan.coloring.color_axis = d;
+                    }
+                }
+            }
+            else if constexpr (interface_type == InterfaceType::level_jump_direction)
+            {
+                auto direction_index   = static_cast<std::size_t>(find(comput_stencil, direction));
+                auto comput_stencil_it = make_stencil_iterator(mesh, comput_stencil);
+                auto interface_it      = make_leveljump_iterator<0>(comput_stencil_it, direction_index);
+
+                auto& coarse_cells      = mesh[mesh_id_t::cells][level];
+                auto& fine_cells        = mesh[mesh_id_t::cells][level + 1];
+                auto shifted_fine_cells = translate(fine_cells, -direction);
+                auto fine_intersect     = intersection(coarse_cells, shifted_fine_cells).on(level + 1);
+                plan.record(fine_intersect, interface_it, comput_stencil_it);
+
+                // the fine interfaces of a coarse row share the same coarse cells
+                plan.coloring = {1, 0};
+            }
+            else if constexpr (interface_type == InterfaceType::level_jump_opposite_direction)
+            {
+                Stencil<comput_stencil_size, dim> minus_comput_stencil = comput_stencil - direction;
+                DirectionVector<dim> minus_direction                   = -direction;
+
+                auto minus_direction_index   = static_cast<std::size_t>(find(minus_comput_stencil, minus_direction));
+                auto minus_comput_stencil_it = make_stencil_iterator(mesh, minus_comput_stencil);
+                auto interface_it            = make_leveljump_iterator<1>(minus_comput_stencil_it, minus_direction_index);
+
+                auto& coarse_cells      = mesh[mesh_id_t::cells][level];
+                auto& fine_cells        = mesh[mesh_id_t::cells][level + 1];
+                auto shifted_fine_cells = translate(fine_cells, direction);
+                auto fine_intersect     = intersection(coarse_cells, shifted_fine_cells).on(level + 1);
+                plan.record(fine_intersect, interface_it, minus_comput_stencil_it);
+
+                // the fine interfaces of a coarse row share the same coarse cells
+                plan.coloring = {1, 0};
+            }
+            else if constexpr (interface_type == InterfaceType::boundary)
+            {
+                auto interface_it      = make_stencil_iterator(mesh, in_out_stencil<dim>(direction));
+                auto comput_stencil_it = make_stencil_iterator(mesh, comput_stencil);
+
+                auto bdry = boundary(mesh, level, direction);
+                plan.record(bdry, interface_it, comput_stencil_it);
+            }
+            if constexpr (has_mesh_version<Mesh>::value)
+            {
+                plan.mark_near_halo(mesh);
+            }
+            else
+            {
+                plan.near_halo.assign(plan.mesh_intervals.size(), false);
+                plan.split_near_halo();
+            }
+            return plan;
+        }
+
+        /**
+         * Plans of the last interface_plan_cache_size mesh versions (see Mesh_base::version()).
+         * The plans are shared with the loops being replayed, so that they remain valid after being evicted.
+         */
+        template <class Mesh, std::size_t comput_stencil_size>
+        class InterfacePlanCache
+        {
+          public:
+
+            static constexpr std::size_t dim = Mesh::dim;
+            using plan_t                     = InterfacePlan<Mesh, comput_stencil_size>;
+
+            template <InterfaceType interface_type>
+            std::shared_ptr<const plan_t> get(const Mesh& mesh,
+                                              std::size_t level,
+                                              const DirectionVector<dim>& direction,
+                                              const Stencil<comput_stencil_size, dim>& comput_stencil)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                for (const auto& entry : m_entries)
+                {
+                    if (entry.version == mesh.version() && entry.interface_type == interface_type && entry.level == level
+                        && entry.direction == direction && entry.comput_stencil == comput_stencil)
+                    {
+                        return entry.plan;
+                    }
+                }
+
+                if (std::find(m_versions.begin(), m_versions.end(), mesh.version()) == m_versions.end())
+                {
+                    if (m_versions.size() == interface_plan_cache_size)
+                    {
+                        std::size_t oldest = m_versions.front();
+                        m_versions.erase(m_versions.begin());
+                        m_entries.erase(std::remove_if(m_entries.begin(),
+                                                       m_entries.end(),
+                                                       [&](const auto& entry)
+                                                       {
+                                                           return entry.version == oldest;
+                                                       }),
+                                        m_entries.end());
+                    }
+                    m_versions.push_back(mesh.version());
+                }
+
+                auto plan = std::make_shared<const plan_t>(make_interface_plan<interface_type>(mesh, level, direction, comput_stencil));
+                m_entries.push_back({mesh.version(), interface_type, level, direction, comput_stencil, plan});
+                return plan;
+            }
+
+          private:
+
+            struct Entry
+            {
+                std::size_t version;
+                InterfaceType interface_type;
+                std::size_t level;
+                DirectionVector<dim> direction;
+                Stencil<comput_stencil_size, dim> comput_stencil;
+                std::shared_ptr<const plan_t> plan;
+            };
+
+            std::mutex m_mutex;
+            std::vector<std::size_t> m_versions; // the most recent last
+            std::vector<Entry> m_entries;
+        };
+
+        /**
+         * Returns the plan of the interfaces of type @param interface_type.
+         * It is built once per mesh version, then taken from the cache as long as the mesh is not modified.
+         */
+        template <InterfaceType interface_type, class Mesh, std::size_t comput_stencil_size>
+        auto interface_plan(const Mesh& mesh,
+                            std::size_t level,
+                            const DirectionVector<Mesh::dim>& direction,
+                            const Stencil<comput_stencil_size, Mesh::dim>& comput_stencil)
+        {
+            if constexpr (has_mesh_version<Mesh>::value && interface_plan_cache_size > 0)
+            {
+                static InterfacePlanCache<Mesh, comput_stencil_size> cache;
+                return cache.template get<interface_type>(mesh, level, direction, comput_stencil);
+            }
+            else
+            {
+                return std::make_shared<const InterfacePlan<Mesh, comput_stencil_size>>(
+                    make_interface_plan<interface_type>(mesh, level, direction, comput_stencil));
+            }
+        }
+
+        template <Run run_type, class MeshIntervals, class Func>
+        void for_each_indexed_meshinterval(const MeshIntervals& mesh_intervals, const RowColoring& coloring, Func&& f)
+        {
+            if constexpr (run_type == Run::Sequential)
+            {
+                for (std::size_t k = 0; k < mesh_intervals.size(); ++k)
+                {
+                    f(mesh_intervals[k], k);
+                }
+            }
+            else if constexpr (run_type == Run::ParallelColored)
+            {
+                colored_for_each_indexed_meshinterval(mesh_intervals, coloring, std::forward<Func>(f));
+            }
+            else
+            {
+                // the intervals are already collected: the tasks are replaced by dynamically scheduled chunks
+                balanced_for_each_indexed_meshinterval<run_type>(mesh_intervals, std::forward<Func>(f));
+            }
+        }
+
+        /**
+         * Applies @param f(mesh_interval, k) on the mesh intervals of @param plan selected by interface_selection(),
+         * where k is the position of the mesh interval in the plan (the mesh interval can be a piece of it with the parallel policies).
+         */
+        template <Run run_type, class Plan, class Func>
+        void for_each_planned_meshinterval(const Plan& plan, Func&& f)
+        {
+            auto selection = interface_selection();
+            bool split     = !plan.near_halo_selection.mesh_intervals.empty();
+            if (selection == InterfaceSelection::all || (selection == InterfaceSelection::away_from_halo && !split))
+            {
+                for_each_indexed_meshinterval<run_type>(plan.mesh_intervals, plan.coloring, std::forward<Func>(f));
+                return;
+            }
+            if (!split) // no interval near the halo
+            {
+                return;
+            }
+
+            const auto& selected = selection == InterfaceSelection::near_halo ? plan.near_halo_selection : plan.away_from_halo_selection;
+            for_each_indexed_meshinterval<run_type>(selected.mesh_intervals,
+                                                    plan.coloring,
+                                                    [&](const auto& mesh_interval, std::size_t j)
+                                                    {
+                                                        f(mesh_interval, selected.positions[j]);
+                                                    });
+        }
+    }
+
     /**
      * Iterates over the interfaces of same level only (no level jump).
      * Same parameters as the preceding function.
@@ -16,14 +444,10 @@ namespace samurai
                                                  Func&& f)
     {
         static constexpr std::size_t dim = Mesh::dim;
-        using mesh_id_t                  = typename Mesh::mesh_id_t;
-        using mesh_interval_t            = typename Mesh::mesh_interval_t;
 
-        Stencil<2, dim> interface_stencil = in_out_stencil<dim>(direction);
+        auto plan = detail::interface_plan<detail::InterfaceType::same_level>(mesh, level, direction, comput_stencil);
 
-        auto& cells        = mesh[mesh_id_t::cells][level];
-        auto shifted_cells = translate(cells, -direction);
-        auto intersect     = intersection(cells, shifted_cells);
+        Stencil<2, dim> interface_stencil = in_out_stencil<dim>(direction);
 
 #ifdef SAMURAI_WITH_OPENMP
         std::size_t num_threads = static_cast<std::size_t>(omp_get_max_threads());
@@ -39,31 +463,31 @@ namespace samurai
         auto comput_stencil_it       = make_stencil_iterator(mesh, comput_stencil);
 #endif
 
-        for_each_meshinterval<mesh_interval_t, run_type>(intersect,
-                                                         [&](auto mesh_interval)
-                                                         {
+        detail::for_each_planned_meshinterval<run_type>(*plan,
+                                                        [&](const auto& mesh_interval, std::size_t k)
+                                                        {
 #ifdef SAMURAI_WITH_OPENMP
-                                                             std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
-                                                             auto& interface_it      = interface_its[thread];
-                                                             auto& comput_stencil_it = comput_stencil_its[thread];
+                                                            std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
+                                                            auto& interface_it      = interface_its[thread];
+                                                            auto& comput_stencil_it = comput_stencil_its[thread];
 #endif
-                                                             interface_it.init(mesh_interval);
-                                                             comput_stencil_it.init(mesh_interval);
-
-                                                             if constexpr (get_type == Get::Intervals)
-                                                             {
-                                                                 f(interface_it, comput_stencil_it);
-                                                             }
-                                                             else if constexpr (get_type == Get::Cells)
-                                                             {
-                                                                 for (std::size_t ii = 0; ii < mesh_interval.i.size(); ++ii)
-                                                                 {
-                                                                     f(interface_it.cells(), comput_stencil_it.cells());
-                                                                     interface_it.move_next();
-                                                                     comput_stencil_it.move_next();
-                                                                 }
-                                                             }
-                                                         });
+                                                            interface_it.init(mesh_interval, plan->interface_cells[k]);
+                                                            comput_stencil_it.init(mesh_interval, plan->comput_cells[k]);
+
+                                                            if constexpr (get_type == Get::Intervals)
+                                                            {
+                                                                f(interface_it, comput_stencil_it);
+                                                            }
+                                                            else if constexpr (get_type == Get::Cells)
+                                                            {
+                                                                for (std::size_t ii = 0; ii < mesh_interval.i.size(); ++ii)
+                                                                {
+                                                                    f(interface_it.cells(), comput_stencil_it.cells());
+                                                                    interface_it.move_next();
+                                                                    comput_stencil_it.move_next();
+                                                                }
+                                                            }
+                                                        });
     }
 
     /**
@@ -86,19 +510,12 @@ namespace samurai
                                                            const Stencil<comput_stencil_size, Mesh::dim>& comput_stencil,
                                                            Func&& f)
     {
-        using mesh_id_t       = typename Mesh::mesh_id_t;
-        using mesh_interval_t = typename Mesh::mesh_interval_t;
-
         if (level >= mesh.max_level())
         {
             return;
         }
 
-        auto& coarse_cells = mesh[mesh_id_t::cells][level];
-        auto& fine_cells   = mesh[mesh_id_t::cells][level + 1];
-
-        auto shifted_fine_cells = translate(fine_cells, -direction);
-        auto fine_intersect     = intersection(coarse_cells, shifted_fine_cells).on(level + 1);
+        auto plan = detail::interface_plan<detail::InterfaceType::level_jump_direction>(mesh, level, direction, comput_stencil);
 
         int direction_index_int = find(comput_stencil, direction);
         auto direction_index    = static_cast<std::size_t>(direction_index_int);
@@ -118,31 +535,31 @@ namespace samurai
         auto interface_it            = make_leveljump_iterator<0>(comput_stencil_it, direction_index);
 #endif
 
-        for_each_meshinterval<mesh_interval_t, run_type>(fine_intersect,
-                                                         [&](auto fine_mesh_interval)
-                                                         {
+        detail::for_each_planned_meshinterval<run_type>(*plan,
+                                                        [&](const auto& fine_mesh_interval, std::size_t k)
+                                                        {
 #ifdef SAMURAI_WITH_OPENMP
-                                                             std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
-                                                             auto& interface_it      = interface_its[thread];
-                                                             auto& comput_stencil_it = comput_stencil_its[thread];
+                                                            std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
+                                                            auto& interface_it      = interface_its[thread];
+                                                            auto& comput_stencil_it = comput_stencil_its[thread];
 #endif
-                                                             comput_stencil_it.init(fine_mesh_interval);
-                                                             interface_it.init(fine_mesh_interval);
-
-                                                             if constexpr (get_type == Get::Intervals)
-                                                             {
-                                                                 f(interface_it, comput_stencil_it);
-                                                             }
-                                                             else if constexpr (get_type == Get::Cells)
-                                                             {
-                                                                 for (std::size_t ii = 0; ii < fine_mesh_interval.i.size(); ++ii)
-                                                                 {
-                                                                     f(interface_it.cells(), comput_stencil_it.cells());
-                                                                     interface_it.move_next();
-                                                                     comput_stencil_it.move_next();
-                                                                 }
-                                                             }
-                                                         });
+                                                            comput_stencil_it.init(fine_mesh_interval, plan->comput_cells[k]);
+                                                            interface_it.init(fine_mesh_interval, plan->interface_cells[k]);
+
+                                                            if constexpr (get_type == Get::Intervals)
+                                                            {
+                                                                f(interface_it, comput_stencil_it);
+                                                            }
+                                                            else if constexpr (get_type == Get::Cells)
+                                                            {
+                                                                for (std::size_t ii = 0; ii < fine_mesh_interval.i.size(); ++ii)
+                                                                {
+                                                                    f(interface_it.cells(), comput_stencil_it.cells());
+                                                                    interface_it.move_next();
+                                                                    comput_stencil_it.move_next();
+                                                                }
+                                                            }
+                                                        });
     }
 
     /**
@@ -166,19 +583,13 @@ namespace samurai
                                                                     Func&& f)
     {
         static constexpr std::size_t dim = Mesh::dim;
-        using mesh_id_t                  = typename Mesh::mesh_id_t;
-        using mesh_interval_t            = typename Mesh::mesh_interval_t;
 
         if (level >= mesh.max_level())
         {
             return;
         }
 
-        auto& coarse_cells = mesh[mesh_id_t::cells][level];
-        auto& fine_cells   = mesh[mesh_id_t::cells][level + 1];
-
-        auto shifted_fine_cells = translate(fine_cells, direction);
-        auto fine_intersect     = intersection(coarse_cells, shifted_fine_cells).on(level + 1);
+        auto plan = detail::interface_plan<detail::InterfaceType::level_jump_opposite_direction>(mesh, level, direction, comput_stencil);
 
         Stencil<comput_stencil_size, dim> minus_comput_stencil = comput_stencil - direction;
         DirectionVector<dim> minus_direction                   = -direction;
@@ -201,31 +612,31 @@ namespace samurai
         auto interface_it            = make_leveljump_iterator<1>(minus_comput_stencil_it, minus_direction_index);
 #endif
 
-        for_each_meshinterval<mesh_interval_t, run_type>(fine_intersect,
-                                                         [&](auto fine_mesh_interval)
-                                                         {
+        detail::for_each_planned_meshinterval<run_type>(*plan,
+                                                        [&](const auto& fine_mesh_interval, std::size_t k)
+                                                        {
 #ifdef SAMURAI_WITH_OPENMP
-                                                             std::size_t thread            = static_cast<std::size_t>(omp_get_thread_num());
-                                                             auto& interface_it            = interface_its[thread];
-                                                             auto& minus_comput_stencil_it = comput_stencil_its[thread];
+                                                            std::size_t thread            = static_cast<std::size_t>(omp_get_thread_num());
+                                                            auto& interface_it            = interface_its[thread];
+                                                            auto& minus_comput_stencil_it = comput_stencil_its[thread];
 #endif
-                                                             minus_comput_stencil_it.init(fine_mesh_interval);
-                                                             interface_it.init(fine_mesh_interval);
-
-                                                             if constexpr (get_type == Get::Intervals)
-                                                             {
-                                                                 f(interface_it, minus_comput_stencil_it);
-                                                             }
-                                                             else if constexpr (get_type == Get::Cells)
-                                                             {
-                                                                 for (std::size_t ii = 0; ii < fine_mesh_interval.i.size(); ++ii)
-                                                                 {
-                                                                     f(interface_it.cells(), minus_comput_stencil_it.cells());
-                                                                     interface_it.move_next();
-                                                                     minus_comput_stencil_it.move_next();
-                                                                 }
-                                                             }
-                                                         });
+                                                            minus_comput_stencil_it.init(fine_mesh_interval, plan->comput_cells[k]);
+                                                            interface_it.init(fine_mesh_interval, plan->interface_cells[k]);
+
+                                                            if constexpr (get_type == Get::Intervals)
+                                                            {
+                                                                f(interface_it, minus_comput_stencil_it);
+                                                            }
+                                                            else if constexpr (get_type == Get::Cells)
+                                                            {
+                                                                for (std::size_t ii = 0; ii < fine_mesh_interval.i.size(); ++ii)
+                                                                {
+                                                                    f(interface_it.cells(), minus_comput_stencil_it.cells());
+                                                                    interface_it.move_next();
+                                                                    minus_comput_stencil_it.move_next();
+                                                                }
+                                                            }
+                                                        });
     }
 
     /**
@@ -341,7 +752,11 @@ namespace samurai
                                                 Func&& f)
     {
         static constexpr std::size_t dim = Mesh::dim;
-        using mesh_interval_t            = typename Mesh::mesh_interval_t;
+
+        // two boundary interfaces in the same direction never share a cell: no coloring is needed
+        static constexpr Run plan_run_type = (run_type == Run::ParallelColored) ? Run::Parallel : run_type;
+
+        auto plan = detail::interface_plan<detail::InterfaceType::boundary>(mesh, level, direction, comput_stencil);
 
         Stencil<2, dim> interface_stencil = in_out_stencil<dim>(direction);
 
@@ -359,31 +774,30 @@ namespace samurai
         auto comput_stencil_it       = make_stencil_iterator(mesh, comput_stencil);
 #endif
 
-        auto bdry = boundary(mesh, level, direction);
-        for_each_meshinterval<mesh_interval_t, run_type>(bdry,
-                                                         [&](auto mesh_interval)
-                                                         {
+        detail::for_each_planned_meshinterval<plan_run_type>(*plan,
+                                                             [&](const auto& mesh_interval, std::size_t k)
+                                                             {
 #ifdef SAMURAI_WITH_OPENMP
-                                                             std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
-                                                             auto& interface_it      = interface_its[thread];
-                                                             auto& comput_stencil_it = comput_stencil_its[thread];
+                                                                 std::size_t thread      = static_cast<std::size_t>(omp_get_thread_num());
+                                                                 auto& interface_it      = interface_its[thread];
+                                                                 auto& comput_stencil_it = comput_stencil_its[thread];
 #endif
-                                                             interface_it.init(mesh_interval);
-                                                             comput_stencil_it.init(mesh_interval);
-                                                             if constexpr (get_type == Get::Intervals)
-                                                             {
-                                                                 f(interface_it.cells()[0], comput_stencil_it);
-                                                             }
-                                                             else if constexpr (get_type == Get::Cells)
-                                                             {
-                                                                 for (std::size_t ii = 0; ii < mesh_interval.i.size(); ++ii)
+                                                                 interface_it.init(mesh_interval, plan->interface_cells[k]);
+                                                                 comput_stencil_it.init(mesh_interval, plan->comput_cells[k]);
+                                                                 if constexpr (get_type == Get::Intervals)
+                                                                 {
+                                                                     f(interface_it.cells()[0], comput_stencil_it);
+                                                                 }
+                                                                 else if constexpr (get_type == Get::Cells)
                                                                  {
-                                                                     f(interface_it.cells()[0], comput_stencil_it.cells());
-                                                                     interface_it.move_next();
-                                                                     comput_stencil_it.move_next();
+                                                                     for (std::size_t ii = 0; ii < mesh_interval.i.size(); ++ii)
+                                                                     {
+                                                                         f(interface_it.cells()[0], comput_stencil_it.cells());
+                                                                         interface_it.move_next();
+                                                                         comput_stencil_it.move_next();
+                                                                     }
                                                                  }
-                                                             }
-                                                         });
+                                                             });
     }
 
     template <Run run_type = Run::Sequential, Get get_type = Get::Cells, class Mesh, std::size_t comput_stencil_size, class Func>
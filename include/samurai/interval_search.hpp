@@ -0,0 +1,273 @@
+// Copyright 2018-2024 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace samurai
+{
+    ///////////////////////////////
+    // IntervalSearch definition //
+    ///////////////////////////////
+
+    /** @class IntervalSearch
+     *  @brief Search accelerator for the intervals of a LevelCellArray.
+     *
+     * The bounds of the intervals are packed in contiguous arrays of
+     * coordinates (an interval takes 24 bytes with the default index type
+     * where a coordinate takes 4 bytes). The sub-ranges of a dimension are
+     * searched with a branchless binary search, ending with a linear scan that
+     * the compiler can vectorize. The last dimension is always searched as a
+     * whole: its ends are also stored in Eytzinger (BFS) order so that the
+     * top levels of the search tree stay in cache.
+     *
+     * @tparam Dim The dimension.
+     * @tparam TInterval The type of the intervals.
+     */
+    template <std::size_t Dim, class TInterval>
+    class IntervalSearch
+    {
+      public:
+
+        static constexpr auto dim = Dim;
+        using interval_t          = TInterval;
+        using value_t             = typename interval_t::value_t;
+
+        /// Under this size, a range is scanned linearly.
+        static constexpr std::size_t linear_scan_size = 16;
+
+        template <class LCA>
+        explicit IntervalSearch(const LCA& lca);
+
+        std::ptrdiff_t find(std::size_t d, std::size_t start_index, std::size_t end_index, value_t coord) const;
+
+        std::size_t lower_bound(std::size_t d, std::size_t start_index, std::size_t end_index, value_t coord) const;
+        bool contains(std::size_t d, std::size_t pos, value_t coord) const;
+
+      private:
+
+        std::size_t eytzinger_lower_bound(value_t coord) const;
+
+        void build_eytzinger(std::size_t& i, std::size_t k);
+
+        std::array<std::vector<value_t>, dim> m_starts;
+        std::array<std::vector<value_t>, dim> m_ends;
+        std::vector<value_t> m_eytzinger_ends;    ///< Ends of the last dimension in Eytzinger order (1-based)
+        std::vector<std::size_t> m_eytzinger_pos; ///< Position in the sorted array of each Eytzinger node
+    };
+
+    ///////////////////////////////////
+    // IntervalSearch implementation //
+    ///////////////////////////////////
+
+    template <std::size_t Dim, class TInterval>
+    template <class LCA>
+    inline IntervalSearch<Dim, TInterval>::IntervalSearch(const LCA& lca)
+    {
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            m_starts[d].reserve(lca[d].size());
+            m_ends[d].reserve(lca[d].size());
+            for (const auto& interval : lca[d])
+            {
+                m_starts[d].push_back(interval.start);
+                m_ends[d].push_back(interval.end);
+            }
+        }
+
+        const std::size_t n = m_ends[dim - 1].size();
+        m_eytzinger_ends.resize(n + 1);
+        m_eytzinger_pos.resize(n + 1);
+        std::size_t i = 0;
+        build_eytzinger(i, 1);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void IntervalSearch<Dim, TInterval>::build_eytzinger(std::size_t& i, std::size_t k)
+    {
+        if (k < m_eytzinger_ends.size())
+        {
+            build_eytzinger(i, 2 * k);
+            m_eytzinger_ends[k] = m_ends[dim - 1][i];
+            m_eytzinger_pos[k]  = i++;
+            build_eytzinger(i, 2 * k + 1);
+        }
+    }
+
+    /**
+     * Position of the interval containing coord in [start_index, end_index[
+     * along the dimension d, -1 if there is no such interval.
+     */
+    template <std::size_t Dim, class TInterval>
+    inline std::ptrdiff_t IntervalSearch<Dim, TInterval>::find(std::size_t d, std::size_t start_index, std::size_t end_index, value_t coord) const
+    {
+        const std::size_t pos = (d == dim - 1 && start_index == 0 && end_index == m_ends[d].size())
+                                  ? eytzinger_lower_bound(coord)
+                                  : lower_bound(d, start_index, end_index, coord);
+
+        if (pos < end_index && contains(d, pos, coord))
+        {
+            return static_cast<std::ptrdiff_t>(pos);
+        }
+        return -1;
+    }
+
+    /// Check if the interval at the position pos along the dimension d contains coord.
+    template <std::size_t Dim, class TInterval>
+    inline bool IntervalSearch<Dim, TInterval>::contains(std::size_t d, std::size_t pos, value_t coord) const
+    {
+        return m_starts[d][pos] <= coord && coord < m_ends[d][pos];
+    }
+
+    /// First position in [start_index, end_index[ where the end of the interval is not lower than coord.
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t
+    IntervalSearch<Dim, TInterval>::lower_bound(std::size_t d, std::size_t start_index, std::size_t end_index, value_t coord) const
+    {
+        const value_t* base = m_ends[d].data() + start_index;
+        std::size_t n       = end_index - start_index;
+
+        while (n > linear_scan_size)
+        {
+            const std::size_t half = n / 2;
+            base                   = (base[half] < coord) ? base + half : base;
+            n -= half;
+        }
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            count += (base[i] < coord);
+        }
+        return static_cast<std::size_t>(base - m_ends[d].data()) + count;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t IntervalSearch<Dim, TInterval>::eytzinger_lower_bound(value_t coord) const
+    {
+        // Nodes 16k to 16k + 15 (for 32 bits coordinates) are the descendants
+        // of k four levels below: they share a cache line that can be fetched early.
+        constexpr std::size_t nodes_per_line = 64 / sizeof(value_t);
+
+        const std::size_t n = m_eytzinger_ends.size();
+        std::size_t k       = 1;
+        while (k < n)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(m_eytzinger_ends.data() + nodes_per_line * k);
+#endif
+            k = 2 * k + (m_eytzinger_ends[k] < coord);
+        }
+        // Go back to the last node where we went left
+        while (k & 1)
+        {
+            k >>= 1;
+        }
+        k >>= 1;
+        return (k == 0) ? n - 1 : m_eytzinger_pos[k];
+    }
+
+    namespace detail
+    {
+        /** @class LazyCache
+         *  @brief Object built on first access, which can be shared between threads.
+         *
+         * A copy starts empty: the object is built again when needed.
+         */
+        template <class T>
+        class LazyCache
+        {
+          public:
+
+            LazyCache() = default;
+            LazyCache(const LazyCache&) noexcept;
+            LazyCache(LazyCache&& other) noexcept;
+
+            LazyCache& operator=(const LazyCache& other) noexcept;
+            LazyCache& operator=(LazyCache&& other) noexcept;
+
+            ~LazyCache();
+
+            template <class Func>
+            const T& get(Func&& build) const;
+
+            void reset() noexcept;
+
+          private:
+
+            mutable std::atomic<const T*> m_ptr{nullptr};
+        };
+
+        template <class T>
+        inline LazyCache<T>::LazyCache(const LazyCache&) noexcept
+        {
+        }
+
+        template <class T>
+        inline LazyCache<T>::LazyCache(LazyCache&& other) noexcept
+            : m_ptr(other.m_ptr.exchange(nullptr))
+        {
+        }
+
+        template <class T>
+        inline auto LazyCache<T>::operator=(const LazyCache& other) noexcept -> LazyCache&
+        {
+            if (this != &other)
+            {
+                reset();
+            }
+            return *this;
+        }
+
+        template <class T>
+        inline auto LazyCache<T>::operator=(LazyCache&& other) noexcept -> LazyCache&
+        {
+            if (this != &other)
+            {
+                delete m_ptr.exchange(other.m_ptr.exchange(nullptr));
+            }
+            return *this;
+        }
+
+        template <class T>
+        inline LazyCache<T>::~LazyCache()
+        {
+            reset();
+        }
+
+        /**
+         * Return the cached object, build() is called if it doesn't exist yet.
+         * If several threads build it at the same time, only one result is kept.
+         */
+        template <class T>
+        template <class Func>
+        inline const T& LazyCache<T>::get(Func&& build) const
+        {
+            const T* ptr = m_ptr.load(std::memory_order_acquire);
+            if (ptr == nullptr)
+            {
+                const T* new_ptr = new T(build());
+                if (m_ptr.compare_exchange_strong(ptr, new_ptr, std::memory_order_acq_rel))
+                {
+                    ptr = new_ptr;
+                }
+                else
+                {
+                    delete new_ptr;
+                }
+            }
+            return *ptr;
+        }
+
+        /// Remove the cached object (not thread-safe with get).
+        template <class T>
+        inline void LazyCache<T>::reset() noexcept
+        {
+            delete m_ptr.exchange(nullptr);
+        }
+    } // namespace detail
+} // namespace samurai
@@ -19,6 +19,7 @@
 #include "algorithm.hpp"
 #include "box.hpp"
 #include "interval.hpp"
+#include "interval_search.hpp"
 #include "level_cell_list.hpp"
 #include "mesh_interval.hpp"
 #include "samurai_config.hpp"
@@ -82,7 +83,8 @@ namespace samurai
         using index_type = std::array<value_t, dim>;
 
         LevelCellArray() = default;
-        LevelCellArray(const LevelCellList<Dim, TInterval>& lcl);
+        LevelCellArray(const LevelCellList<Dim, TInterval, CellListBackend::map>& lcl);
+        LevelCellArray(const LevelCellList<Dim, TInterval, CellListBackend::flat>& lcl);
 
         template <class F, class... CT>
         LevelCellArray(subset_operator<F, CT...> set);
@@ -134,7 +136,9 @@ namespace samurai
         template <class E>
         cell_t get_cell(const xt::xexpression<E>& coord) const;
 
-        void update_index();
+        void update_index(std::size_t first_index = 0);
+
+        const IntervalSearch<dim, interval_t>& search_accelerator() const;
 
         //// checks whether the container is empty
         bool empty() const;
@@ -149,9 +153,11 @@ namespace samurai
         std::size_t nb_cells() const;
 
         const std::vector<interval_t>& operator[](std::size_t d) const;
+        /// Mutable intervals: invalidates the search accelerator of find()
         std::vector<interval_t>& operator[](std::size_t d);
 
         const std::vector<std::size_t>& offsets(std::size_t d) const;
+        /// Mutable offsets: invalidates the search accelerator of find()
         std::vector<std::size_t>& offsets(std::size_t d);
 
         std::size_t level() const;
@@ -177,6 +183,7 @@ namespace samurai
                 ar& m_offsets[d];
             }
             ar& m_level;
+            m_search.reset();
         }
 #endif
 
@@ -196,6 +203,8 @@ namespace samurai
         std::array<std::vector<std::size_t>, dim - 1> m_offsets; ///< Offsets in interval list for each dim >
                                                                  ///< 1
         std::size_t m_level = 0;
+
+        detail::LazyCache<IntervalSearch<dim, interval_t>> m_search; ///< Built by the first find(), reset by update_index()
     };
 
     ////////////////////////////////////////
@@ -266,11 +275,62 @@ namespace samurai
         mutable coord_type m_index;
     };
 
+    //////////////////////////////////////
+    // LevelCellArrayBuilder definition //
+    //////////////////////////////////////
+    namespace detail
+    {
+        /** @class LevelCellArrayBuilder
+         *  @brief Streaming construction of a LevelCellArray.
+         *
+         * The intervals and the offsets are directly appended to the arrays of
+         * the LevelCellArray. The (y, z) rows must be opened in lexicographic
+         * order (the last coordinate being the most significant) and the
+         * x-intervals of a row must be added by increasing start. open_row and
+         * add_interval return false if this order is not respected: the
+         * LevelCellArray is then left in an unspecified state.
+         *
+         * @tparam LCA The type of the LevelCellArray to build (must be empty).
+         */
+        template <class LCA>
+        class LevelCellArrayBuilder
+        {
+          public:
+
+            static constexpr std::size_t dim = LCA::dim;
+            using interval_t                 = typename LCA::interval_t;
+            using value_t                    = typename interval_t::value_t;
+            using index_t                    = typename interval_t::index_t;
+
+            explicit LevelCellArrayBuilder(LCA& lca);
+
+            template <class IndexYZ>
+            bool open_row(const IndexYZ& index_yz);
+
+            bool add_interval(const interval_t& interval);
+
+            void finalize();
+
+          private:
+
+            void start_row();
+            void close(std::size_t d);
+
+            LCA& m_lca;
+            std::array<interval_t, dim> m_current; ///< Working interval for each dimension > 0
+            std::array<value_t, dim - 1> m_row;    ///< Coordinates of the opened row
+            std::array<value_t, dim - 1> m_previous;
+            std::size_t m_row_start = 0; ///< Position of the first x-interval of the current row
+            bool m_row_started      = false;
+            bool m_has_previous     = false;
+        };
+    } // namespace detail
+
     ///////////////////////////////////
     // LevelCellArray implementation //
     ///////////////////////////////////
     template <std::size_t Dim, class TInterval>
-    inline LevelCellArray<Dim, TInterval>::LevelCellArray(const LevelCellList<Dim, TInterval>& lcl)
+    inline LevelCellArray<Dim, TInterval>::LevelCellArray(const LevelCellList<Dim, TInterval, CellListBackend::map>& lcl)
         : m_level(lcl.level())
     {
         /* Estimating reservation size
@@ -298,10 +358,71 @@ namespace samurai
         }
     }
 
+    /**
+     * Construction from a flat level cell list: the rows are already sorted
+     * so that the arrays are filled in one pass.
+     */
+    template <std::size_t Dim, class TInterval>
+    inline LevelCellArray<Dim, TInterval>::LevelCellArray(const LevelCellList<Dim, TInterval, CellListBackend::flat>& lcl)
+        : m_level(lcl.level())
+    {
+        detail::LevelCellArrayBuilder<LevelCellArray<Dim, TInterval>> builder(*this);
+
+        lcl.for_each_row(
+            [&](const auto& index_yz, const auto& interval_list)
+            {
+                builder.open_row(index_yz);
+                for (const auto& interval : interval_list)
+                {
+                    builder.add_interval(interval);
+                }
+            });
+        builder.finalize();
+    }
+
+    /**
+     * Construction from a subset.
+     *
+     * The subset is usually visited in lexicographic order so that the
+     * arrays are filled in one pass. Otherwise (e.g. the rows of a subset
+     * projected on a finer level are visited once per coarse interval),
+     * the intervals are first gathered in a LevelCellList.
+     */
     template <std::size_t Dim, class TInterval>
     template <class F, class... CT>
     inline LevelCellArray<Dim, TInterval>::LevelCellArray(subset_operator<F, CT...> set)
+        : m_level(set.level())
     {
+        if (dim == 1 || set.level() <= set.common_level())
+        {
+            detail::LevelCellArrayBuilder<LevelCellArray<Dim, TInterval>> builder(*this);
+            bool ordered = true;
+
+            set(
+                [&](const auto& i, const auto& index)
+                {
+                    if (ordered)
+                    {
+                        ordered = builder.open_row(index) && builder.add_interval(i);
+                    }
+                });
+
+            if (ordered)
+            {
+                builder.finalize();
+                return;
+            }
+
+            for (auto& cells : m_cells)
+            {
+                cells.clear();
+            }
+            for (auto& offsets : m_offsets)
+            {
+                offsets.clear();
+            }
+        }
+
         LevelCellList<Dim, TInterval> lcl{set.level()};
 
         set(
@@ -555,17 +676,38 @@ namespace samurai
     /**
      * Update the index in the x-intervals allowing to navigate in the
      * Field data structure.
+     *
+     * @param first_index The position of the first cell in the Field data
+     * structure (the cells of the other levels may be stored before).
+     */
+    template <std::size_t Dim, class TInterval>
+    inline void LevelCellArray<Dim, TInterval>::update_index(std::size_t first_index)
+    {
+        std::size_t acc_size = first_index;
+        for (auto& interval : m_cells[0])
+        {
+            interval.index = storage_index<index_t>(acc_size, interval);
+            acc_size += interval.size();
+        }
+        m_search.reset();
+    }
+
+    /**
+     * Packed copy of the intervals used to speed up find().
+     *
+     * It is built on the first call and invalidated by update_index() and
+     * the non-const accessors to the intervals and the offsets. A reference
+     * obtained from these accessors must not be kept to modify the intervals
+     * after a call to find().
      */
     template <std::size_t Dim, class TInterval>
-    inline void LevelCellArray<Dim, TInterval>::update_index()
-    {
-        std::size_t acc_size = 0;
-        for_each_interval(*this,
-                          [&](auto, auto& interval, auto)
-                          {
-                              interval.index = safe_subs<index_t>(acc_size, interval.start);
-                              acc_size += interval.size();
-                          });
+    inline auto LevelCellArray<Dim, TInterval>::search_accelerator() const -> const IntervalSearch<dim, interval_t>&
+    {
+        return m_search.get(
+            [this]()
+            {
+                return IntervalSearch<dim, interval_t>(*this);
+            });
     }
 
     template <std::size_t Dim, class TInterval>
@@ -683,6 +825,8 @@ namespace samurai
     template <std::size_t Dim, class TInterval>
     inline auto LevelCellArray<Dim, TInterval>::operator[](std::size_t d) -> std::vector<interval_t>&
     {
+        // the intervals may be modified: the search accelerator is built again by the next find()
+        m_search.reset();
         return m_cells[d];
     }
 
@@ -696,6 +840,7 @@ namespace samurai
     template <std::size_t Dim, class TInterval>
     inline std::vector<std::size_t>& LevelCellArray<Dim, TInterval>::offsets(std::size_t d)
     {
+        m_search.reset();
         assert(d > 0);
         return m_offsets[d - 1];
     }
@@ -870,6 +1015,170 @@ namespace samurai
         return out;
     }
 
+    //////////////////////////////////////////
+    // LevelCellArrayBuilder implementation //
+    //////////////////////////////////////////
+    namespace detail
+    {
+        template <class LCA>
+        inline LevelCellArrayBuilder<LCA>::LevelCellArrayBuilder(LCA& lca)
+            : m_lca(lca)
+        {
+            m_current.fill(interval_t(0, 0, 0));
+        }
+
+        /// Set the (y, z) coordinates of the next x-intervals.
+        template <class LCA>
+        template <class IndexYZ>
+        inline bool LevelCellArrayBuilder<LCA>::open_row(const IndexYZ& index_yz)
+        {
+            std::array<value_t, dim - 1> row;
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                row[d] = index_yz[d];
+            }
+
+            if (m_has_previous)
+            {
+                for (std::size_t d = dim - 1; d-- > 0;)
+                {
+                    if (row[d] != m_previous[d])
+                    {
+                        if (row[d] < m_previous[d])
+                        {
+                            return false;
+                        }
+                        break;
+                    }
+                }
+
+                // Reopening the last row: just continue it
+                if (row == m_previous)
+                {
+                    m_row_started = true;
+                    return true;
+                }
+            }
+            m_row         = row;
+            m_row_started = false;
+            return true;
+        }
+
+        /// Add a x-interval in the opened row.
+        template <class LCA>
+        inline bool LevelCellArrayBuilder<LCA>::add_interval(const interval_t& interval)
+        {
+            if (!interval.is_valid())
+            {
+                return true;
+            }
+
+            // The row is created with its first interval so that empty rows
+            // don't appear in the LevelCellArray.
+            if (!m_row_started)
+            {
+                start_row();
+            }
+
+            auto& cells_x = m_lca[0];
+            if (cells_x.size() > m_row_start)
+            {
+                if (interval.start < cells_x.back().start)
+                {
+                    return false;
+                }
+                if (interval.start <= cells_x.back().end)
+                {
+                    cells_x.back().end = std::max(cells_x.back().end, interval.end);
+                    return true;
+                }
+            }
+            cells_x.emplace_back(interval);
+            return true;
+        }
+
+        template <class LCA>
+        inline void LevelCellArrayBuilder<LCA>::start_row()
+        {
+            // Highest dimension where the coordinate changes
+            std::size_t changed = dim - 1;
+            if (m_has_previous)
+            {
+                changed = 0;
+                for (std::size_t d = dim - 1; d > 0; --d)
+                {
+                    if (m_row[d - 1] != m_previous[d - 1])
+                    {
+                        changed = d;
+                        break;
+                    }
+                }
+            }
+
+            // Below this dimension, we start the list of a new parent
+            for (std::size_t d = 1; d < changed; ++d)
+            {
+                close(d);
+            }
+
+            for (std::size_t d = changed; d > 0; --d)
+            {
+                const auto i  = m_row[d - 1];
+                auto& offsets = m_lca.offsets(d);
+                auto& current = m_current[d];
+
+                if (current.is_valid() && i == current.end)
+                {
+                    // we are just continuing the current interval
+                    ++current.end;
+                }
+                else
+                {
+                    close(d);
+                    current = interval_t(i, i + 1, static_cast<index_t>(offsets.size()) - i);
+                }
+                offsets.emplace_back(m_lca[d - 1].size());
+            }
+
+            m_row_start    = m_lca[0].size();
+            m_previous     = m_row;
+            m_has_previous = true;
+            m_row_started  = true;
+        }
+
+        template <class LCA>
+        inline void LevelCellArrayBuilder<LCA>::close(std::size_t d)
+        {
+            if (m_current[d].is_valid())
+            {
+                m_lca[d].emplace_back(m_current[d]);
+                m_current[d] = interval_t(0, 0, 0);
+            }
+        }
+
+        /// Add the working intervals and the last offsets.
+        template <class LCA>
+        inline void LevelCellArrayBuilder<LCA>::finalize()
+        {
+            if (!m_has_previous)
+            {
+                return;
+            }
+
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                close(d);
+            }
+            // Additionnal offset so that [m_offset[i], m_offset[i+1][ is always
+            // valid.
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                m_lca.offsets(d).emplace_back(m_lca[d - 1].size());
+            }
+            m_has_previous = false;
+        }
+    } // namespace detail
+
     ////////////////////////////////////////////
     // LevelCellArray_iterator implementation //
     ////////////////////////////////////////////
@@ -3,13 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <xtensor/xfixed.hpp>
 #include <xtensor/xview.hpp>
 
+#include "arena.hpp"
 #include "cell.hpp"
 #include "list_of_intervals.hpp"
 #include "samurai_config.hpp"
@@ -23,7 +29,7 @@ namespace samurai
         struct PartialGrid
         {
             using next_type = typename PartialGrid<TCoord, TIntervalList, N - 1>::type;
-            using type      = std::map<TCoord, next_type>;
+            using type      = std::map<TCoord, next_type, std::less<TCoord>, ArenaAllocator<std::pair<const TCoord, next_type>>>;
         };
 
         template <typename TCoord, typename TIntervalList>
@@ -47,15 +53,31 @@ namespace samurai
         template <typename GridYZ, typename Index, std::size_t dim>
         inline decltype(auto) access_grid_yz(GridYZ& grid_yz, const Index& index, std::integral_constant<std::size_t, dim>)
         {
-            // For other dimensions, we dive into the nested std::map
-            return access_grid_yz(grid_yz[index[dim - 1]], index, std::integral_constant<std::size_t, dim - 1>{});
+            // For other dimensions, we dive into the nested std::map.
+            // A new entry shares the allocator (and thus the arena) of its parent.
+            using next_allocator_t = typename std::decay_t<GridYZ>::mapped_type::allocator_type;
+
+            auto& next = grid_yz.try_emplace(index[dim - 1], next_allocator_t(grid_yz.get_allocator())).first->second;
+            return access_grid_yz(next, index, std::integral_constant<std::size_t, dim - 1>{});
         }
     } // namespace detail
 
     //////////////////////////////
     // LevelCellList definition //
     //////////////////////////////
-    template <std::size_t Dim, class TInterval = default_config::interval_t>
+
+    /** @class LevelCellList
+     *  @brief Sparse list of intervals of a given level used to build a LevelCellArray.
+     *
+     * The primary template stores the intervals in nested std::map
+     * (CellListBackend::map). The nodes of the maps and of the interval
+     * lists are drawn from the arena given at construction, if any.
+     *
+     * @tparam Dim The dimension.
+     * @tparam TInterval The type of the intervals.
+     * @tparam backend The storage used to gather the intervals.
+     */
+    template <std::size_t Dim, class TInterval = default_config::interval_t, CellListBackend backend = default_config::cell_list_backend>
     class LevelCellList
     {
       public:
@@ -72,7 +94,7 @@ namespace samurai
         using grid_t = typename detail::PartialGrid<coord_index_t, list_interval_t, dim - 1>::type;
 
         LevelCellList();
-        LevelCellList(std::size_t level);
+        LevelCellList(std::size_t level, MonotonicArena* arena = nullptr);
 
         const list_interval_t& operator[](const index_yz_t& index) const;
         list_interval_t& operator[](const index_yz_t& index);
@@ -97,69 +119,309 @@ namespace samurai
     //////////////////////////////////
     // LevelCellList implementation //
     //////////////////////////////////
-    template <std::size_t Dim, class TInterval>
-    inline LevelCellList<Dim, TInterval>::LevelCellList()
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline LevelCellList<Dim, TInterval, backend>::LevelCellList()
         : m_level{0}
     {
     }
 
-    template <std::size_t Dim, class TInterval>
-    inline LevelCellList<Dim, TInterval>::LevelCellList(std::size_t level)
-        : m_level{level}
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline LevelCellList<Dim, TInterval, backend>::LevelCellList(std::size_t level, MonotonicArena* arena)
+        : m_grid_yz(typename grid_t::allocator_type(arena))
+        , m_level{level}
     {
     }
 
     /// Constant access to the interval list at given dim-1 coordinates
-    template <std::size_t Dim, class TInterval>
-    inline auto LevelCellList<Dim, TInterval>::operator[](const index_yz_t& index) const -> const list_interval_t&
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline auto LevelCellList<Dim, TInterval, backend>::operator[](const index_yz_t& index) const -> const list_interval_t&
     {
         return detail::access_grid_yz(m_grid_yz, index, std::integral_constant<std::size_t, dim - 1>{});
     }
 
     /// Mutable access to the interval list at given dim-1 coordinates
-    template <std::size_t Dim, class TInterval>
-    inline auto LevelCellList<Dim, TInterval>::operator[](const index_yz_t& index) -> list_interval_t&
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline auto LevelCellList<Dim, TInterval, backend>::operator[](const index_yz_t& index) -> list_interval_t&
     {
         return detail::access_grid_yz(m_grid_yz, index, std::integral_constant<std::size_t, dim - 1>{});
     }
 
     /// Underlying sparse array
-    template <std::size_t Dim, class TInterval>
-    inline auto LevelCellList<Dim, TInterval>::grid_yz() const -> const grid_t&
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline auto LevelCellList<Dim, TInterval, backend>::grid_yz() const -> const grid_t&
     {
         return m_grid_yz;
     }
 
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline std::size_t LevelCellList<Dim, TInterval, backend>::level() const
+    {
+        return m_level;
+    }
+
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline bool LevelCellList<Dim, TInterval, backend>::empty() const
+    {
+        return m_grid_yz.empty();
+    }
+
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline void LevelCellList<Dim, TInterval, backend>::to_stream(std::ostream& os) const
+    {
+        os << "LevelCellList\n";
+        os << "=============\n";
+        os << "TODO\n";
+    }
+
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline void LevelCellList<Dim, TInterval, backend>::add_cell(const Cell<dim, interval_t>& cell)
+    {
+        using namespace xt::placeholders;
+
+        (*this)[xt::view(cell.indices, xt::range(1, _))].add_point(cell.indices[0]);
+    }
+
+    ///////////////////////////////////
+    // Flat LevelCellList definition //
+    ///////////////////////////////////
+
+    /** @class LevelCellList<Dim, TInterval, CellListBackend::flat>
+     *  @brief Level cell list where each (y, z) row is stored in a flat array.
+     *
+     * The rows are located with an open-addressing hash table and the
+     * intervals of a row are stored contiguously in a FlatListOfIntervals.
+     * The rows are sorted only once, when the LevelCellArray is built.
+     */
+    template <std::size_t Dim, class TInterval>
+    class LevelCellList<Dim, TInterval, CellListBackend::flat>
+    {
+      public:
+
+        static constexpr auto dim = Dim;
+        using interval_t          = TInterval;
+        using index_t             = typename interval_t::index_t;
+        using coord_index_t       = typename interval_t::coord_index_t;
+        using index_yz_t          = xt::xtensor_fixed<coord_index_t, xt::xshape<dim - 1>>;
+        using list_interval_t     = FlatListOfIntervals<coord_index_t, index_t>;
+
+        LevelCellList();
+        LevelCellList(std::size_t level);
+
+        const list_interval_t& operator[](const index_yz_t& index) const;
+        list_interval_t& operator[](const index_yz_t& index);
+
+        std::size_t level() const;
+
+        bool empty() const;
+
+        std::size_t nb_rows() const;
+
+        void to_stream(std::ostream& os) const;
+
+        void add_cell(const Cell<dim, interval_t>& cell);
+
+        template <class Func>
+        void for_each_row(Func&& f) const;
+
+      private:
+
+        struct row_t
+        {
+            index_yz_t index;
+            list_interval_t intervals;
+        };
+
+        static std::size_t hash(const index_yz_t& index);
+        static bool row_less(const index_yz_t& lhs, const index_yz_t& rhs);
+
+        std::size_t find_slot(const index_yz_t& index) const;
+        void rehash(std::size_t table_size);
+
+        std::deque<row_t> m_rows;         ///< Rows in insertion order (references stay valid).
+        std::vector<std::size_t> m_table; ///< Hash table: row position + 1, 0 for an empty slot.
+        std::size_t m_last_row = 0;       ///< Last accessed row.
+        bool m_sorted          = true;    ///< Rows have been inserted in lexicographic order.
+        std::size_t m_level;
+    };
+
+    ///////////////////////////////////////
+    // Flat LevelCellList implementation //
+    ///////////////////////////////////////
+
+    template <std::size_t Dim, class TInterval>
+    inline LevelCellList<Dim, TInterval, CellListBackend::flat>::LevelCellList()
+        : m_level{0}
+    {
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline LevelCellList<Dim, TInterval, CellListBackend::flat>::LevelCellList(std::size_t level)
+        : m_level{level}
+    {
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t LevelCellList<Dim, TInterval, CellListBackend::flat>::hash(const index_yz_t& index)
+    {
+        std::size_t h = 0;
+        for (std::size_t d = 0; d < dim - 1; ++d)
+        {
+            h ^= static_cast<std::size_t>(index[d]) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+
+    /// Lexicographic order of the rows (the last coordinate is the most significant).
+    template <std::size_t Dim, class TInterval>
+    inline bool LevelCellList<Dim, TInterval, CellListBackend::flat>::row_less(const index_yz_t& lhs, const index_yz_t& rhs)
+    {
+        for (std::size_t d = dim - 1; d-- > 0;)
+        {
+            if (lhs[d] != rhs[d])
+            {
+                return lhs[d] < rhs[d];
+            }
+        }
+        return false;
+    }
+
+    /// Slot of the row in the hash table (an empty slot if the row doesn't exist).
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t LevelCellList<Dim, TInterval, CellListBackend::flat>::find_slot(const index_yz_t& index) const
+    {
+        const std::size_t mask = m_table.size() - 1;
+        std::size_t slot       = hash(index) & mask;
+        while (m_table[slot] != 0 && m_rows[m_table[slot] - 1].index != index)
+        {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void LevelCellList<Dim, TInterval, CellListBackend::flat>::rehash(std::size_t table_size)
+    {
+        m_table.assign(table_size, 0);
+        for (std::size_t r = 0; r < m_rows.size(); ++r)
+        {
+            m_table[find_slot(m_rows[r].index)] = r + 1;
+        }
+    }
+
+    /// Constant access to the interval list at given dim-1 coordinates
     template <std::size_t Dim, class TInterval>
-    inline std::size_t LevelCellList<Dim, TInterval>::level() const
+    inline auto LevelCellList<Dim, TInterval, CellListBackend::flat>::operator[](const index_yz_t& index) const -> const list_interval_t&
+    {
+        static const list_interval_t empty_list;
+
+        if (m_table.empty())
+        {
+            return empty_list;
+        }
+        auto row = m_table[find_slot(index)];
+        return (row == 0) ? empty_list : m_rows[row - 1].intervals;
+    }
+
+    /// Mutable access to the interval list at given dim-1 coordinates (the row is created if needed)
+    template <std::size_t Dim, class TInterval>
+    inline auto LevelCellList<Dim, TInterval, CellListBackend::flat>::operator[](const index_yz_t& index) -> list_interval_t&
+    {
+        // Producers usually fill a row before moving to the next one
+        if (!m_rows.empty() && m_rows[m_last_row].index == index)
+        {
+            return m_rows[m_last_row].intervals;
+        }
+
+        // Keep the load factor of the hash table under 1/2
+        if (2 * (m_rows.size() + 1) > m_table.size())
+        {
+            rehash(std::max<std::size_t>(16, 2 * m_table.size()));
+        }
+
+        auto slot = find_slot(index);
+        if (m_table[slot] == 0)
+        {
+            if (!m_rows.empty() && row_less(index, m_rows.back().index))
+            {
+                m_sorted = false;
+            }
+            m_rows.push_back({index, {}});
+            m_table[slot] = m_rows.size();
+        }
+        m_last_row = m_table[slot] - 1;
+        return m_rows[m_last_row].intervals;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t LevelCellList<Dim, TInterval, CellListBackend::flat>::level() const
     {
         return m_level;
     }
 
     template <std::size_t Dim, class TInterval>
-    inline bool LevelCellList<Dim, TInterval>::empty() const
+    inline bool LevelCellList<Dim, TInterval, CellListBackend::flat>::empty() const
     {
-        return m_grid_yz.empty();
+        return m_rows.empty();
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t LevelCellList<Dim, TInterval, CellListBackend::flat>::nb_rows() const
+    {
+        return m_rows.size();
     }
 
     template <std::size_t Dim, class TInterval>
-    inline void LevelCellList<Dim, TInterval>::to_stream(std::ostream& os) const
+    inline void LevelCellList<Dim, TInterval, CellListBackend::flat>::to_stream(std::ostream& os) const
     {
         os << "LevelCellList\n";
         os << "=============\n";
-        os << "TODO\n";
+        for_each_row(
+            [&](const auto& index, const auto& intervals)
+            {
+                os << index << ": " << intervals << "\n";
+            });
     }
 
     template <std::size_t Dim, class TInterval>
-    inline void LevelCellList<Dim, TInterval>::add_cell(const Cell<dim, interval_t>& cell)
+    inline void LevelCellList<Dim, TInterval, CellListBackend::flat>::add_cell(const Cell<dim, interval_t>& cell)
     {
         using namespace xt::placeholders;
 
         (*this)[xt::view(cell.indices, xt::range(1, _))].add_point(cell.indices[0]);
     }
 
+    /**
+     * Apply f(index_yz, intervals) on each row in lexicographic order.
+     */
     template <std::size_t Dim, class TInterval>
-    inline std::ostream& operator<<(std::ostream& out, const LevelCellList<Dim, TInterval>& level_cell_list)
+    template <class Func>
+    inline void LevelCellList<Dim, TInterval, CellListBackend::flat>::for_each_row(Func&& f) const
+    {
+        if (m_sorted)
+        {
+            for (const auto& row : m_rows)
+            {
+                f(row.index, row.intervals);
+            }
+            return;
+        }
+
+        std::vector<std::size_t> order(m_rows.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(),
+                  order.end(),
+                  [&](std::size_t r1, std::size_t r2)
+                  {
+                      return row_less(m_rows[r1].index, m_rows[r2].index);
+                  });
+        for (auto r : order)
+        {
+            f(m_rows[r].index, m_rows[r].intervals);
+        }
+    }
+
+    template <std::size_t Dim, class TInterval, CellListBackend backend>
+    inline std::ostream& operator<<(std::ostream& out, const LevelCellList<Dim, TInterval, backend>& level_cell_list)
     {
         level_cell_list.to_stream(out);
         return out;
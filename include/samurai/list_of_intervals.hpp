@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <forward_list>
 #include <iostream>
+#include <vector>
 
+#include "arena.hpp"
 #include "interval.hpp"
 #include "samurai_config.hpp"
 
@@ -35,17 +38,22 @@ namespace samurai
     /** @class ListOfIntervals
      *  @brief Forward list of intervals.
      *
+     * The nodes can be drawn from a MonotonicArena given at construction.
+     * The last node is tracked so that intervals added in increasing order
+     * (the most common case) are appended in constant time.
+     *
      * @tparam TValue  The coordinate type (must be signed).
      * @tparam TIndex  The index type (must be signed).
      */
     template <typename TValue, typename TIndex = default_config::index_t>
-    struct ListOfIntervals : private std::forward_list<Interval<TValue, TIndex>>
+    struct ListOfIntervals : private std::forward_list<Interval<TValue, TIndex>, ArenaAllocator<Interval<TValue, TIndex>>>
     {
-        using value_t    = TValue;
-        using index_t    = TIndex;
-        using interval_t = Interval<value_t, index_t>;
+        using value_t        = TValue;
+        using index_t        = TIndex;
+        using interval_t     = Interval<value_t, index_t>;
+        using allocator_type = ArenaAllocator<interval_t>;
 
-        using list_t = std::forward_list<interval_t>;
+        using list_t = std::forward_list<interval_t, allocator_type>;
         using list_t::before_begin;
         using list_t::begin;
         using list_t::cbegin;
@@ -53,21 +61,104 @@ namespace samurai
         using list_t::empty;
         using list_t::end;
 
-        using list_t::erase_after;
         using const_iterator = typename list_t::const_iterator;
         using iterator       = typename list_t::iterator;
         using value_type     = typename list_t::value_type;
 
+        ListOfIntervals();
+        explicit ListOfIntervals(const allocator_type& alloc);
+
+        ListOfIntervals(const ListOfIntervals& other);
+        ListOfIntervals(ListOfIntervals&& other) noexcept;
+
+        ListOfIntervals& operator=(const ListOfIntervals& other);
+        ListOfIntervals& operator=(ListOfIntervals&& other) noexcept;
+
+        ~ListOfIntervals() = default;
+
         std::size_t size() const;
 
         void add_point(value_t point);
         void add_interval(const interval_t& interval);
+
+      private:
+
+        void find_last();
+        void take_last(ListOfIntervals& other);
+
+        iterator m_last; ///< Last node of the list (before_begin() if the list is empty).
     };
 
     ////////////////////////////////////
     // ListOfIntervals implementation //
     ////////////////////////////////////
 
+    template <typename TValue, typename TIndex>
+    inline ListOfIntervals<TValue, TIndex>::ListOfIntervals()
+        : m_last(before_begin())
+    {
+    }
+
+    template <typename TValue, typename TIndex>
+    inline ListOfIntervals<TValue, TIndex>::ListOfIntervals(const allocator_type& alloc)
+        : list_t(alloc)
+        , m_last(before_begin())
+    {
+    }
+
+    template <typename TValue, typename TIndex>
+    inline ListOfIntervals<TValue, TIndex>::ListOfIntervals(const ListOfIntervals& other)
+        : list_t(other)
+    {
+        find_last();
+    }
+
+    template <typename TValue, typename TIndex>
+    inline ListOfIntervals<TValue, TIndex>::ListOfIntervals(ListOfIntervals&& other) noexcept
+        : list_t(std::move(other))
+    {
+        take_last(other);
+    }
+
+    template <typename TValue, typename TIndex>
+    inline auto ListOfIntervals<TValue, TIndex>::operator=(const ListOfIntervals& other) -> ListOfIntervals&
+    {
+        list_t::operator=(other);
+        find_last();
+        return *this;
+    }
+
+    template <typename TValue, typename TIndex>
+    inline auto ListOfIntervals<TValue, TIndex>::operator=(ListOfIntervals&& other) noexcept -> ListOfIntervals&
+    {
+        if (this != &other)
+        {
+            list_t::operator=(std::move(other));
+            take_last(other);
+        }
+        return *this;
+    }
+
+    template <typename TValue, typename TIndex>
+    inline void ListOfIntervals<TValue, TIndex>::find_last()
+    {
+        m_last = before_begin();
+        for (auto it = begin(); it != end(); ++it)
+        {
+            m_last = it;
+        }
+    }
+
+    /// The nodes of other have been moved into this list: the last node is moved too.
+    template <typename TValue, typename TIndex>
+    inline void ListOfIntervals<TValue, TIndex>::take_last(ListOfIntervals& other)
+    {
+        // before_begin() is not a node and thus is not moved
+        m_last = empty() ? before_begin() : other.m_last;
+        other.list_t::clear();
+        other.m_last = other.before_begin();
+    }
+
     /// Number of intervals stored in the list.
     template <typename TValue, typename TIndex>
     inline std::size_t ListOfIntervals<TValue, TIndex>::size() const
@@ -91,6 +182,20 @@ namespace samurai
             return;
         }
 
+        // Fast path: the interval is after the beginning of the last one
+        if (empty() || m_last->start <= interval.start)
+        {
+            if (empty() || m_last->end < interval.start)
+            {
+                m_last = this->insert_after(m_last, interval);
+            }
+            else
+            {
+                m_last->end = std::max(m_last->end, interval.end);
+            }
+            return;
+        }
+
         auto predicate = [interval](const auto& value)
         {
             return interval.start <= value.end;
@@ -113,7 +218,13 @@ namespace samurai
         while (it_end != end() && interval.end >= it_end->start)
         {
             it.second->end = std::max(it_end->end, interval.end);
-            it_end         = erase_after(it.second);
+            it_end         = this->erase_after(it.second);
+        }
+
+        // the last node may have been merged
+        if (it_end == end())
+        {
+            m_last = it.second;
         }
     }
 
@@ -126,4 +237,111 @@ namespace samurai
         }
         return out;
     }
+
+    ////////////////////////////////////
+    // FlatListOfIntervals definition //
+    ////////////////////////////////////
+
+    /** @class FlatListOfIntervals
+     *  @brief Sorted list of intervals stored in a contiguous array.
+     *
+     * It has the same interface as ListOfIntervals. Appending an interval
+     * after (or overlapping) the last one is done in constant time.
+     *
+     * @tparam TValue  The coordinate type (must be signed).
+     * @tparam TIndex  The index type (must be signed).
+     */
+    template <typename TValue, typename TIndex = default_config::index_t>
+    struct FlatListOfIntervals : private std::vector<Interval<TValue, TIndex>>
+    {
+        using value_t    = TValue;
+        using index_t    = TIndex;
+        using interval_t = Interval<value_t, index_t>;
+
+        using list_t = std::vector<interval_t>;
+        using list_t::begin;
+        using list_t::cbegin;
+        using list_t::cend;
+        using list_t::clear;
+        using list_t::empty;
+        using list_t::end;
+        using list_t::size;
+
+        using const_iterator = typename list_t::const_iterator;
+        using iterator       = typename list_t::iterator;
+        using value_type     = typename list_t::value_type;
+
+        void add_point(value_t point);
+        void add_interval(const interval_t& interval);
+    };
+
+    ////////////////////////////////////////
+    // FlatListOfIntervals implementation //
+    ////////////////////////////////////////
+
+    /// Add a point inside the list.
+    template <typename TValue, typename TIndex>
+    inline void FlatListOfIntervals<TValue, TIndex>::add_point(value_t point)
+    {
+        add_interval({point, point + 1});
+    }
+
+    /// Add an interval inside the list.
+    template <typename TValue, typename TIndex>
+    inline void FlatListOfIntervals<TValue, TIndex>::add_interval(const interval_t& interval)
+    {
+        if (!interval.is_valid())
+        {
+            return;
+        }
+
+        // Fast path: the new interval is after the last one or only touches it
+        if (empty() || this->back().end < interval.start)
+        {
+            this->push_back(interval);
+            return;
+        }
+        if (this->back().start <= interval.start)
+        {
+            this->back().end = std::max(this->back().end, interval.end);
+            return;
+        }
+
+        auto it = std::lower_bound(begin(),
+                                   end(),
+                                   interval.start,
+                                   [](const auto& value, auto start)
+                                   {
+                                       return value.end < start;
+                                   });
+
+        // we are between two intervals, insert it
+        if (interval.end < it->start)
+        {
+            this->insert(it, interval);
+            return;
+        }
+
+        // else there is an overlap
+        it->start = std::min(it->start, interval.start);
+        it->end   = std::max(it->end, interval.end);
+
+        auto it_end = std::next(it);
+        while (it_end != end() && interval.end >= it_end->start)
+        {
+            it->end = std::max(it_end->end, interval.end);
+            ++it_end;
+        }
+        this->erase(std::next(it), it_end);
+    }
+
+    template <typename value_t, typename index_t>
+    inline std::ostream& operator<<(std::ostream& out, const FlatListOfIntervals<value_t, index_t>& interval_list)
+    {
+        for (const auto& interval : interval_list)
+        {
+            out << interval << " ";
+        }
+        return out;
+    }
 } // namespace samurai
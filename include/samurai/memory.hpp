@@ -39,8 +39,12 @@ namespace samurai
     template <class D, class Config>
     std::size_t memory_usage(const Mesh_base<D, Config>& mesh, bool verbose = false)
     {
-        using mesh_id_t = typename Mesh_base<D, Config>::mesh_id_t;
-        std::size_t mem = 0;
+        using mesh_t     = Mesh_base<D, Config>;
+        using mesh_id_t  = typename mesh_t::mesh_id_t;
+        using interval_t = typename mesh_t::interval_t;
+
+        std::size_t mem          = 0;
+        std::size_t nb_intervals = 0;
         for (std::size_t i = 0; i < static_cast<std::size_t>(mesh_id_t::count); ++i)
         {
             auto id            = static_cast<mesh_id_t>(i);
@@ -50,6 +54,18 @@ namespace samurai
                 std::cout << fmt::format("Mesh {}: {}", id, mem_id) << std::endl;
             }
             mem += mem_id;
+            for (std::size_t level = mesh[id].min_level(); level <= mesh[id].max_level(); ++level)
+            {
+                nb_intervals += mesh[id][level].nb_intervals();
+            }
+        }
+
+        // Savings of a compact interval type (see default_config::compact_interval_t)
+        if (verbose && sizeof(interval_t) < sizeof(default_config::interval_t))
+        {
+            constexpr std::size_t default_size = sizeof(default_config::interval_t);
+            std::size_t saved                  = nb_intervals * (default_size - sizeof(interval_t));
+            std::cout << fmt::format("Intervals of {} bytes instead of {}: {} saved", sizeof(interval_t), default_size, saved) << std::endl;
         }
         return mem;
     }
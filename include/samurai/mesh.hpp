@@ -3,13 +3,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "box.hpp"
 #include "cell_array.hpp"
 #include "cell_list.hpp"
+#include "space_filling_curve.hpp"
 
 #include "subset/subset_op.hpp"
 
@@ -23,6 +31,51 @@ namespace mpi = boost::mpi;
 
 namespace samurai
 {
+    namespace detail
+    {
+        /// Backend of the cell lists given by the mesh configuration (default if not specified)
+        template <class Config, class = void>
+        struct config_cell_list_backend : std::integral_constant<CellListBackend, default_config::cell_list_backend>
+        {
+        };
+
+        template <class Config>
+        struct config_cell_list_backend<Config, std::void_t<decltype(Config::cell_list_backend)>>
+            : std::integral_constant<CellListBackend, Config::cell_list_backend>
+        {
+        };
+
+        /// Initial partition method given by the mesh configuration (default if not specified)
+        template <class Config, class = void>
+        struct config_partition_method : std::integral_constant<PartitionMethod, default_config::partition_method>
+        {
+        };
+
+        template <class Config>
+        struct config_partition_method<Config, std::void_t<decltype(Config::partition_method)>>
+            : std::integral_constant<PartitionMethod, Config::partition_method>
+        {
+        };
+
+        /// Migration method of load_balance() given by the mesh configuration (default if not specified)
+        template <class Config, class = void>
+        struct config_load_balancing_method : std::integral_constant<LoadBalancingMethod, default_config::load_balancing_method>
+        {
+        };
+
+        template <class Config>
+        struct config_load_balancing_method<Config, std::void_t<decltype(Config::load_balancing_method)>>
+            : std::integral_constant<LoadBalancingMethod, Config::load_balancing_method>
+        {
+        };
+
+        /// Returns a version number never given before (see Mesh_base::version())
+        inline std::size_t new_mesh_version()
+        {
+            static std::atomic<std::size_t> counter{0};
+            return ++counter;
+        }
+    } // namespace detail
 
     template <class CellArray, class MeshID>
     struct MeshIDArray : private std::array<CellArray, static_cast<std::size_t>(MeshID::count)>
@@ -71,7 +124,7 @@ namespace samurai
         using index_t    = typename interval_t::index_t;
 
         using cell_t   = Cell<dim, interval_t>;
-        using cl_type  = CellList<dim, interval_t, max_refinement_level>;
+        using cl_type  = CellList<dim, interval_t, max_refinement_level, detail::config_cell_list_backend<config>::value>;
         using lcl_type = typename cl_type::lcl_type;
 
         using ca_type  = CellArray<dim, interval_t, max_refinement_level>;
@@ -97,6 +150,7 @@ namespace samurai
         const std::array<bool, dim>& periodicity() const;
         // std::vector<int>& neighbouring_ranks();
         std::vector<mpi_subdomain_t>& mpi_neighbourhood();
+        std::size_t version() const;
 
         void swap(Mesh_base& mesh) noexcept;
 
@@ -121,15 +175,24 @@ namespace samurai
         template <class E>
         cell_t get_cell(std::size_t level, const xt::xexpression<E>& coord) const;
 
+        template <class Coords>
+        void find_batch(std::size_t level, const Coords& coords, std::vector<index_t>& indices) const;
+
         void update_mesh_neighbour();
         void to_stream(std::ostream& os) const;
 
+        double load_imbalance(const std::vector<double>& level_weights = {}) const;
+        std::vector<double> load_fluxes(std::size_t n_iterations = load_balancing_iterations) const;
+        std::vector<ca_type> load_balancing(std::size_t n_iterations = load_balancing_iterations) const;
+        std::vector<ca_type> space_filling_curve_partition(const std::vector<double>& level_weights = {}) const;
+
       protected:
 
         using derived_type = D;
 
         Mesh_base() = default; // cppcheck-suppress uninitMemberVar
         Mesh_base(const cl_type& cl, const self_type& ref_mesh);
+        Mesh_base(const ca_type& ca, const self_type& ref_mesh);
         Mesh_base(const cl_type& cl, std::size_t min_level, std::size_t max_level);
         Mesh_base(const samurai::Box<double, dim>& b, std::size_t start_level, std::size_t min_level, std::size_t max_level);
         Mesh_base(const samurai::Box<double, dim>& b,
@@ -147,12 +210,12 @@ namespace samurai
       private:
 
         void construct_subdomain();
+        void update_neighbourhood();
         void construct_union();
         void update_sub_mesh();
         void renumbering();
         void partition_mesh(std::size_t start_level, const Box<double, dim>& global_box);
-        void load_balancing();
-        void load_transfer(const std::vector<double>& load_fluxes);
+        std::vector<ca_type> load_transfer(const std::vector<double>& fluxes) const;
 
         lca_type m_domain;
         lca_type m_subdomain;
@@ -163,6 +226,7 @@ namespace samurai
         ca_type m_union;
         // std::vector<int> m_neighbouring_ranks;
         std::vector<mpi_subdomain_t> m_mpi_neighbourhood;
+        std::size_t m_version = detail::new_mesh_version();
 
 #ifdef SAMURAI_WITH_MPI
         friend class boost::serialization::access;
@@ -179,6 +243,10 @@ namespace samurai
             ar& m_union;
             ar& m_min_level;
             ar& m_min_level;
+            if constexpr (Archive::is_loading::value)
+            {
+                m_version = detail::new_mesh_version();
+            }
         }
 #endif
     };
@@ -215,11 +283,11 @@ namespace samurai
 
 #ifdef SAMURAI_WITH_MPI
         partition_mesh(start_level, b);
-        // load_balancing();
 #else
         this->m_cells[mesh_id_t::cells][start_level] = {start_level, b};
 #endif
         construct_subdomain();
+        update_neighbourhood();
         construct_union();
         update_sub_mesh();
         renumbering();
@@ -241,12 +309,12 @@ namespace samurai
 
 #ifdef SAMURAI_WITH_MPI
         partition_mesh(start_level, b);
-        // load_balancing();
 #else
         this->m_cells[mesh_id_t::cells][start_level] = {start_level, b};
 #endif
 
         construct_subdomain();
+        update_neighbourhood();
         construct_union();
         update_sub_mesh();
         renumbering();
@@ -265,6 +333,7 @@ namespace samurai
 
         construct_subdomain();
         m_domain = m_subdomain;
+        update_neighbourhood();
         construct_union();
         update_sub_mesh();
         renumbering();
@@ -277,12 +346,31 @@ namespace samurai
         , m_min_level(ref_mesh.m_min_level)
         , m_max_level(ref_mesh.m_max_level)
         , m_periodic(ref_mesh.m_periodic)
-        , m_mpi_neighbourhood(ref_mesh.m_mpi_neighbourhood)
-
     {
         m_cells[mesh_id_t::cells] = {cl, false};
 
         construct_subdomain();
+        update_neighbourhood();
+        construct_union();
+        update_sub_mesh();
+        renumbering();
+        update_mesh_neighbour();
+    }
+
+    /**
+     * Construct the mesh from its cells, the other parameters are taken from ref_mesh.
+     */
+    template <class D, class Config>
+    inline Mesh_base<D, Config>::Mesh_base(const ca_type& ca, const self_type& ref_mesh)
+        : m_domain(ref_mesh.m_domain)
+        , m_min_level(ref_mesh.m_min_level)
+        , m_max_level(ref_mesh.m_max_level)
+        , m_periodic(ref_mesh.m_periodic)
+    {
+        m_cells[mesh_id_t::cells] = ca;
+
+        construct_subdomain();
+        update_neighbourhood();
         construct_union();
         update_sub_mesh();
         renumbering();
@@ -292,6 +380,8 @@ namespace samurai
     template <class D, class Config>
     inline auto Mesh_base<D, Config>::cells() -> mesh_t&
     {
+        // the cells may be modified
+        m_version = detail::new_mesh_version();
         return m_cells;
     }
 
@@ -407,6 +497,31 @@ namespace samurai
         return m_cells[mesh_id_t::reference].get_cell(level, coord);
     }
 
+    /**
+     * Index of the cells of a given level at a batch of coordinates (see samurai::find_batch).
+     *
+     * @param level The level of the coordinates.
+     * @param coords A random access container of coordinates (coords[q][d]).
+     * @param indices The index of each cell in the field data (-1 if there is
+     *                no such cell in the reference mesh).
+     */
+    template <class D, class Config>
+    template <class Coords>
+    inline void Mesh_base<D, Config>::find_batch(std::size_t level, const Coords& coords, std::vector<index_t>& indices) const
+    {
+        const auto& lca = m_cells[mesh_id_t::reference][level];
+        samurai::find_batch(lca, coords, indices);
+
+#pragma omp parallel for
+        for (std::size_t q = 0; q < indices.size(); ++q)
+        {
+            if (indices[q] != -1)
+            {
+                indices[q] = lca[0][static_cast<std::size_t>(indices[q])].index + coords[q][0];
+            }
+        }
+    }
+
     template <class D, class Config>
     inline bool Mesh_base<D, Config>::is_periodic(std::size_t d) const
     {
@@ -425,6 +540,18 @@ namespace samurai
         return m_mpi_neighbourhood;
     }
 
+    /**
+     * Identifies the state of the cell arrays: it changes each time they are modified,
+     * and it is exchanged by swap() along with the cells, so that the data computed from
+     * the mesh (e.g. the interface plans) can be cached as long as the version is the same.
+     * The copies of a mesh keep its version.
+     */
+    template <class D, class Config>
+    inline std::size_t Mesh_base<D, Config>::version() const
+    {
+        return m_version;
+    }
+
     template <class D, class Config>
     inline void Mesh_base<D, Config>::swap(Mesh_base<D, Config>& mesh) noexcept
     {
@@ -436,6 +563,7 @@ namespace samurai
         swap(m_union, mesh.m_union);
         swap(m_max_level, mesh.m_max_level);
         swap(m_min_level, mesh.m_min_level);
+        swap(m_version, mesh.m_version);
     }
 
     template <class D, class Config>
@@ -449,24 +577,27 @@ namespace samurai
     {
         m_cells[mesh_id_t::reference].update_index();
 
-        for (std::size_t id = 0; id < static_cast<std::size_t>(mesh_id_t::count); ++id)
+        // Each pair (mesh id, level) is updated independently
+        constexpr std::size_t nb_levels = max_refinement_level + 1;
+        constexpr std::size_t nb_pairs  = static_cast<std::size_t>(mesh_id_t::count) * nb_levels;
+
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t pair = 0; pair < nb_pairs; ++pair)
         {
-            auto mt = static_cast<mesh_id_t>(id);
+            auto mt           = static_cast<mesh_id_t>(pair / nb_levels);
+            std::size_t level = pair % nb_levels;
 
             if (mt != mesh_id_t::reference)
             {
-                for (std::size_t level = 0; level <= max_refinement_level; ++level)
-                {
-                    lca_type& lhs       = m_cells[mt][level];
-                    const lca_type& rhs = m_cells[mesh_id_t::reference][level];
-
-                    auto expr = intersection(lhs, rhs);
-                    expr.apply_interval_index(
-                        [&](const auto& interval_index)
-                        {
-                            lhs[0][interval_index[0]].index = rhs[0][interval_index[1]].index;
-                        });
-                }
+                lca_type& lhs       = m_cells[mt][level];
+                const lca_type& rhs = m_cells[mesh_id_t::reference][level];
+
+                auto expr = intersection(lhs, rhs);
+                expr.apply_interval_index(
+                    [&](const auto& interval_index)
+                    {
+                        lhs[0][interval_index[0]].index = rhs[0][interval_index[1]].index;
+                    });
             }
         }
     }
@@ -520,6 +651,145 @@ namespace samurai
         m_subdomain = {lcl};
     }
 
+    /**
+     * Finds the ranks exchanging ghosts with the current subdomain (collective). Two subdomains are neighbours
+     * if one of them intersects the halo of the other: the cells of the subdomain enlarged by the ghost width
+     * and by the prediction stencil of the ghosts of the two coarser levels (level-jump halo).
+     *
+     * The candidates are selected from the bounding boxes of the halos and the subdomains gathered from all the ranks,
+     * then the halos and the subdomains are only exchanged with these candidates.
+     */
+    template <class D, class Config>
+    inline void Mesh_base<D, Config>::update_neighbourhood()
+    {
+#ifdef SAMURAI_WITH_MPI
+        static constexpr int halo_width = static_cast<int>(config::ghost_width) + static_cast<int>(config::prediction_order);
+
+        mpi::communicator world;
+        auto rank = world.rank();
+        auto size = static_cast<std::size_t>(world.size());
+
+        cl_type cl;
+        for_each_interval(m_cells[mesh_id_t::cells],
+                          [&](std::size_t level, const auto& i, const auto& index)
+                          {
+                              std::size_t coarse_level = (level >= 2) ? level - 2 : 0;
+                              std::size_t shift        = level - coarse_level;
+                              interval_t coarse_i      = i >> shift;
+                              auto coarse_index        = index >> shift;
+                              static_nested_loop<dim - 1>(-halo_width,
+                                                          halo_width + 1,
+                                                          1,
+                                                          [&](auto stencil)
+                                                          {
+                                                              cl[coarse_level][coarse_index + stencil].add_interval(
+                                                                  {coarse_i.start - halo_width, coarse_i.end + halo_width});
+                                                          });
+                          });
+        ca_type halo = {cl};
+
+        // bounding boxes of the halo and of the subdomain at the maximum level (empty if min > max)
+        std::vector<value_t> bounds(4 * dim);
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            bounds[d]           = std::numeric_limits<value_t>::max();
+            bounds[dim + d]     = std::numeric_limits<value_t>::lowest();
+            bounds[2 * dim + d] = std::numeric_limits<value_t>::max();
+            bounds[3 * dim + d] = std::numeric_limits<value_t>::lowest();
+        }
+        for (std::size_t level = halo.min_level(); level <= halo.max_level(); ++level)
+        {
+            if (!halo[level].empty())
+            {
+                auto min_indices = halo[level].min_indices();
+                auto max_indices = halo[level].max_indices();
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    bounds[d]       = std::min(bounds[d], min_indices[d] << (m_max_level - level));
+                    bounds[dim + d] = std::max(bounds[dim + d], max_indices[d] << (m_max_level - level));
+                }
+            }
+        }
+        if (!m_subdomain.empty())
+        {
+            auto min_indices = m_subdomain.min_indices();
+            auto max_indices = m_subdomain.max_indices();
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                bounds[2 * dim + d] = min_indices[d];
+                bounds[3 * dim + d] = max_indices[d];
+            }
+        }
+
+        std::vector<value_t> all_bounds(size * 4 * dim);
+        mpi::all_gather(world, bounds.data(), static_cast<int>(4 * dim), all_bounds.data());
+
+        auto overlap = [&](std::size_t r1, std::size_t box1, std::size_t r2, std::size_t box2)
+        {
+            const value_t* b1 = all_bounds.data() + r1 * 4 * dim + 2 * dim * box1;
+            const value_t* b2 = all_bounds.data() + r2 * 4 * dim + 2 * dim * box2;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                if (b1[d] >= b2[dim + d] || b2[d] >= b1[dim + d])
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<int> candidates;
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            auto me = static_cast<std::size_t>(rank);
+            if (r != me && (overlap(me, 0, r, 1) || overlap(r, 0, me, 1)))
+            {
+                candidates.push_back(static_cast<int>(r));
+            }
+        }
+
+        std::vector<mpi::request> req;
+        for (int candidate : candidates)
+        {
+            req.push_back(world.isend(candidate, candidate, halo));
+            req.push_back(world.isend(candidate, candidate, m_subdomain));
+        }
+
+        auto intersects = [](const ca_type& ca, const lca_type& lca)
+        {
+            bool found = false;
+            for (std::size_t level = ca.min_level(); level <= ca.max_level() && !found; ++level)
+            {
+                if (!ca[level].empty() && !lca.empty())
+                {
+                    intersection(ca[level], lca)
+                        .on(level)(
+                            [&](const auto&, const auto&)
+                            {
+                                found = true;
+                            });
+                }
+            }
+            return found;
+        };
+
+        m_mpi_neighbourhood.clear();
+        for (int candidate : candidates)
+        {
+            ca_type neighbour_halo;
+            lca_type neighbour_subdomain;
+            world.recv(candidate, rank, neighbour_halo);
+            world.recv(candidate, rank, neighbour_subdomain);
+
+            if (intersects(halo, neighbour_subdomain) || intersects(neighbour_halo, m_subdomain))
+            {
+                m_mpi_neighbourhood.push_back(candidate);
+            }
+        }
+        mpi::wait_all(req.begin(), req.end());
+#endif
+    }
+
     template <class D, class Config>
     inline void Mesh_base<D, Config>::construct_union()
     {
@@ -579,6 +849,9 @@ namespace samurai
 
         double h = cell_length(start_level);
 
+        point_t start_pt = global_box.min_corner() / h;
+        point_t end_pt   = global_box.max_corner() / h;
+
         // Computes the number of subdomains in each Cartesian direction
         std::array<int, dim> sizes;
         auto product_of_length   = xt::prod(global_box.length())[0];
@@ -589,166 +862,423 @@ namespace samurai
             sizes[d] = static_cast<int>(floor(pow(size, 1. / dim) * global_box.length()[d] / length_harmonic_avg));
             product_of_sizes *= sizes[d];
         }
-        sizes[dim - 1] = size / product_of_sizes;
-        if (sizes[dim - 1] * product_of_sizes != size)
+        sizes[dim - 1] = (product_of_sizes > 0) ? size / product_of_sizes : 0;
+
+        bool use_space_filling_curve = detail::config_partition_method<config>::value == PartitionMethod::space_filling_curve;
+        if (!use_space_filling_curve && sizes[dim - 1] * product_of_sizes != size)
         {
             if (rank == 0)
             {
-                std::cerr << "Impossible to perform a Cartesian partition of the domain in " << size << " subdomains." << std::endl;
-                std::cerr << "Suggested number: " << (sizes[dim - 1] * product_of_sizes) << "." << std::endl;
+                std::cerr << "Impossible to perform a Cartesian partition of the domain in " << size << " subdomains: ";
+                std::cerr << "the domain is partitioned along a space-filling curve." << std::endl;
             }
-            exit(1);
+            use_space_filling_curve = true;
         }
 
-        // Compute the Cartesian coordinates of the subdomain in the topology
-        int a = rank;
-        xt::xtensor_fixed<int, xt::xshape<dim>> coords;
-        for (std::size_t d = 0; d < dim; ++d)
+        if (use_space_filling_curve)
         {
-            coords[d] = a % sizes[d];
-            a         = a / sizes[d];
+            // the cells of the domain are split into parts of the same size along the Morton curve
+            lcl_type lcl{start_level};
+            morton_partition(box_t{start_pt, end_pt}, static_cast<std::size_t>(size), static_cast<std::size_t>(rank), lcl);
+            this->m_cells[mesh_id_t::cells][start_level] = {lcl};
         }
-
-        // Directional lengths of a standard subdomain
-        point_t start_pt = global_box.min_corner() / h;
-        point_t end_pt   = global_box.max_corner() / h;
-        xt::xtensor_fixed<double, xt::xshape<dim>> lengths;
-        for (std::size_t d = 0; d < dim; ++d)
+        else
         {
-            lengths[d] = ceil((end_pt[d] - start_pt[d]) / static_cast<double>(sizes[d]));
-        }
-
-        // Create the box corresponding to the local subdomain
-        point_t min_corner, max_corner;
-        min_corner = start_pt + coords * lengths;
-        max_corner = min_corner + lengths;
+            // Compute the Cartesian coordinates of the subdomain in the topology
+            int a = rank;
+            xt::xtensor_fixed<int, xt::xshape<dim>> coords;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                coords[d] = a % sizes[d];
+                a         = a / sizes[d];
+            }
 
-        for (std::size_t d = 0; d < dim; ++d)
-        {
-            if (coords[d] == sizes[d] - 1)
+            // Directional lengths of a standard subdomain
+            xt::xtensor_fixed<double, xt::xshape<dim>> lengths;
+            for (std::size_t d = 0; d < dim; ++d)
             {
-                max_corner[d] = end_pt[d];
+                lengths[d] = ceil((end_pt[d] - start_pt[d]) / static_cast<double>(sizes[d]));
             }
-        }
-        box_t subdomain_box                          = {min_corner, max_corner};
-        this->m_cells[mesh_id_t::cells][start_level] = {start_level, subdomain_box};
 
-        m_mpi_neighbourhood.reserve(static_cast<std::size_t>(size) - 1);
-        for (int ir = 0; ir < size; ++ir)
-        {
-            if (ir != rank)
+            // Create the box corresponding to the local subdomain
+            point_t min_corner, max_corner;
+            min_corner = start_pt + coords * lengths;
+            max_corner = min_corner + lengths;
+
+            for (std::size_t d = 0; d < dim; ++d)
             {
-                m_mpi_neighbourhood.push_back(ir);
+                if (coords[d] == sizes[d] - 1)
+                {
+                    max_corner[d] = end_pt[d];
+                }
             }
+            box_t subdomain_box                          = {min_corner, max_corner};
+            this->m_cells[mesh_id_t::cells][start_level] = {start_level, subdomain_box};
         }
+#endif
+    }
 
-        // // Neighbours
-        // m_mpi_neighbourhood.reserve(static_cast<std::size_t>(pow(3, dim) - 1));
-        // auto neighbour = [&](xt::xtensor_fixed<int, xt::xshape<dim>> shift)
-        // {
-        //     auto neighbour_rank            = rank;
-        //     int product_of_preceding_sizes = 1;
-        //     for (std::size_t d = 0; d < dim; ++d)
-        //     {
-        //         neighbour_rank += product_of_preceding_sizes * shift[d];
-        //         product_of_preceding_sizes *= sizes[d];
-        //     }
-        //     return neighbour_rank;
-        // };
-
-        // static_nested_loop<dim, -1, 2>(
-        //     [&](auto& shift)
-        //     {
-        //         if (xt::any(shift))
-        //         {
-        //             for (std::size_t d = 0; d < dim; ++d)
-        //             {
-        //                 if (coords[d] + shift[d] < 0 || coords[d] + shift[d] >= sizes[d])
-        //                 {
-        //                     return;
-        //                 }
-        //             }
-        //             m_mpi_neighbourhood.push_back(neighbour(shift));
-        //         }
-        //     });
+    /**
+     * Ratio between the maximum and the average load per rank, minus one (collective).
+     * The load of a rank is its number of cells, where each cell counts for the weight of its level
+     * in @param level_weights (1 if not given).
+     */
+    template <class D, class Config>
+    double Mesh_base<D, Config>::load_imbalance([[maybe_unused]] const std::vector<double>& level_weights) const
+    {
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
 
+        double load = 0;
+        for (std::size_t level = m_min_level; level <= m_max_level; ++level)
+        {
+            double weight = (level < level_weights.size()) ? level_weights[level] : 1.;
+            load += weight * static_cast<double>(nb_cells(level, mesh_id_t::cells));
+        }
+        double max_load = mpi::all_reduce(world, load, mpi::maximum<double>());
+        double sum_load = mpi::all_reduce(world, load, std::plus<double>());
+        if (sum_load == 0)
+        {
+            return 0;
+        }
+        return max_load * world.size() / sum_load - 1;
+#else
+        return 0;
 #endif
     }
 
+    /**
+     * Loads to transfer between the current subdomain and each neighbouring subdomain (in the order of mpi_neighbourhood()),
+     * negative if the current subdomain sends cells (collective).
+     *
+     * They are given by @param n_iterations of a diffusion process: at each iteration, each rank exchanges with each neighbour
+     * the fraction 1/max(number of neighbours) of their load difference. The flux between two neighbours is therefore
+     * antisymmetric and the total load is conserved.
+     */
     template <class D, class Config>
-    void Mesh_base<D, Config>::load_balancing()
+    std::vector<double> Mesh_base<D, Config>::load_fluxes([[maybe_unused]] std::size_t n_iterations) const
     {
+        std::vector<double> fluxes(m_mpi_neighbourhood.size(), 0);
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
-        auto rank = world.rank();
-
-        std::size_t load = nb_cells(mesh_id_t::cells);
-        std::vector<std::size_t> loads;
 
-        std::vector<double> load_fluxes(m_mpi_neighbourhood.size(), 0);
+        std::vector<std::size_t> nb_neighbours;
+        mpi::all_gather(world, m_mpi_neighbourhood.size(), nb_neighbours);
 
-        const std::size_t n_iterations = 1;
+        double load = static_cast<double>(nb_cells(mesh_id_t::cells));
+        std::vector<double> loads;
 
         for (std::size_t k = 0; k < n_iterations; ++k)
         {
-            world.barrier();
-            if (rank == 0)
+            mpi::all_gather(world, load, loads);
+
+            double load_np1 = load;
+            for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
             {
-                std::cout << "---------------- k = " << k << " ----------------" << std::endl;
+                auto neighbour_rank = static_cast<std::size_t>(m_mpi_neighbourhood[i_rank].rank);
+
+                double weight = 1. / static_cast<double>(std::max(m_mpi_neighbourhood.size(), nb_neighbours[neighbour_rank]));
+                double flux   = weight * (loads[neighbour_rank] - load);
+                fluxes[i_rank] += flux;
+                load_np1 += flux;
             }
-            mpi::all_gather(world, load, loads);
+            load = load_np1;
+        }
+#endif
+        return fluxes;
+    }
+
+    /**
+     * Computes the cells to send to each neighbouring subdomain (in the order of mpi_neighbourhood())
+     * to balance the number of cells per rank (collective): the loads given by load_fluxes() are transferred
+     * by load_transfer().
+     */
+    template <class D, class Config>
+    auto Mesh_base<D, Config>::load_balancing(std::size_t n_iterations) const -> std::vector<ca_type>
+    {
+        return load_transfer(load_fluxes(n_iterations));
+    }
 
-            std::vector<std::size_t> nb_neighbours;
-            mpi::all_gather(world, m_mpi_neighbourhood.size(), nb_neighbours);
+    /**
+     * Chooses the cells to send to each neighbour whose load flux in @param fluxes is negative (the others send cells to this subdomain).
+     *
+     * The cells are moved by blocks: all the cells contained in a cell of the minimum level are sent together,
+     * so that the cells which may be coarsened into the same cell remain on the same rank.
+     * The blocks closest to the neighbour (along the direction joining the centers of the two subdomains)
+     * are chosen first, as long as the transferred load doesn't exceed the flux: a block which doesn't fit
+     * (a block can hold up to 2^(dim * (max_level - min_level)) cells) is skipped and the next ones are tried.
+     */
+    template <class D, class Config>
+    auto Mesh_base<D, Config>::load_transfer([[maybe_unused]] const std::vector<double>& fluxes) const -> std::vector<ca_type>
+    {
+        std::vector<ca_type> cells_to_send(m_mpi_neighbourhood.size());
+#ifdef SAMURAI_WITH_MPI
+        using block_t = std::array<value_t, dim>;
+        using coord_t = std::array<double, dim>;
 
-            double load_np1 = static_cast<double>(load);
-            for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+        const std::size_t block_level = m_min_level;
+
+        auto center = [](std::size_t level, const auto& indices)
+        {
+            coord_t c;
+            double length = 1. / static_cast<double>(std::size_t(1) << level);
+            for (std::size_t d = 0; d < dim; ++d)
             {
-                auto neighbour = m_mpi_neighbourhood[i_rank];
+                c[d] = (indices[d] + 0.5) * length;
+            }
+            return c;
+        };
 
-                auto neighbour_load = loads[static_cast<std::size_t>(neighbour.rank)];
-                int neighbour_load_minus_my_load;
-                if (load < neighbour_load)
+        auto barycenter = [&](const ca_type& ca)
+        {
+            coord_t b{};
+            std::size_t n = 0;
+            for_each_cell(ca,
+                          [&](const auto& cell)
+                          {
+                              auto c = center(cell.level, cell.indices);
+                              for (std::size_t d = 0; d < dim; ++d)
+                              {
+                                  b[d] += c[d];
+                              }
+                              ++n;
+                          });
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                b[d] /= static_cast<double>(std::max(n, std::size_t(1)));
+            }
+            return b;
+        };
+
+        // number of cells in each block
+        std::map<block_t, std::size_t> block_loads;
+        for_each_cell(m_cells[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          block_t block;
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              block[d] = cell.indices[d] >> (cell.level - block_level);
+                          }
+                          block_loads[block]++;
+                      });
+
+        std::vector<block_t> blocks;
+        blocks.reserve(block_loads.size());
+        for (const auto& [block, block_load] : block_loads)
+        {
+            blocks.push_back(block);
+        }
+
+        // destination of each block (the neighbour position in m_mpi_neighbourhood), m_mpi_neighbourhood.size() if it is kept
+        std::map<block_t, std::size_t> destination;
+
+        auto my_center = barycenter(m_cells[mesh_id_t::cells]);
+        for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+        {
+            if (fluxes[i_rank] > -1)
+            {
+                continue;
+            }
+            auto target = static_cast<std::size_t>(-fluxes[i_rank]);
+
+            auto neighbour_center = barycenter(m_mpi_neighbourhood[i_rank].mesh[mesh_id_t::cells]);
+            coord_t direction;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                direction[d] = neighbour_center[d] - my_center[d];
+            }
+
+            std::vector<double> scores(blocks.size());
+            for (std::size_t b = 0; b < blocks.size(); ++b)
+            {
+                auto c    = center(block_level, blocks[b]);
+                scores[b] = 0;
+                for (std::size_t d = 0; d < dim; ++d)
                 {
-                    neighbour_load_minus_my_load = static_cast<int>(neighbour_load - load);
+                    scores[b] += (c[d] - my_center[d]) * direction[d];
                 }
-                else
+            }
+            std::vector<std::size_t> order(blocks.size());
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            std::stable_sort(order.begin(),
+                             order.end(),
+                             [&](auto b1, auto b2)
+                             {
+                                 return scores[b1] > scores[b2];
+                             });
+
+            std::size_t sent = 0;
+            for (auto b : order)
+            {
+                const auto& block = blocks[b];
+                // skip the blocks already sent to another neighbour and those exceeding the flux
+                if (destination.count(block) != 0 || sent + block_loads[block] > target)
                 {
-                    neighbour_load_minus_my_load = -static_cast<int>(load - neighbour_load);
+                    continue;
+                }
+                destination[block] = i_rank;
+                sent += block_loads[block];
+                if (sent == target)
+                {
+                    break;
                 }
-                double weight       = 1. / std::max(m_mpi_neighbourhood.size(), nb_neighbours[neighbour.rank]);
-                load_fluxes[i_rank] = weight * neighbour_load_minus_my_load;
-                load_np1 += load_fluxes[i_rank];
             }
-            load_np1 = floor(load_np1);
-
-            load_transfer(load_fluxes);
-
-            std::cout << rank << ": load = " << load << ", load_np1 = " << load_np1 << std::endl;
+        }
 
-            load = static_cast<std::size_t>(load_np1);
+        std::vector<cl_type> cl(m_mpi_neighbourhood.size());
+        for_each_cell(m_cells[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          block_t block;
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              block[d] = cell.indices[d] >> (cell.level - block_level);
+                          }
+                          auto it = destination.find(block);
+                          if (it != destination.end())
+                          {
+                              cl[it->second][cell.level].add_cell(cell);
+                          }
+                      });
+        for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+        {
+            cells_to_send[i_rank] = {cl[i_rank]};
         }
 #endif
+        return cells_to_send;
     }
 
+    /**
+     * Computes the cells to send to each rank (indexed by rank, the entry of the current rank is empty) so that
+     * the cells of the whole mesh, ordered along the Morton curve, are split into parts of the same weight (collective).
+     *
+     * The cells are ordered by blocks of the minimum level, so that the cells which may be coarsened into the same cell
+     * remain on the same rank. The weight of a cell is given by its level in @param level_weights (1 if not given).
+     * The boundaries of the parts along the curve are found by a parallel bisection on the Morton keys.
+     */
     template <class D, class Config>
-    void Mesh_base<D, Config>::load_transfer([[maybe_unused]] const std::vector<double>& load_fluxes)
+    auto Mesh_base<D, Config>::space_filling_curve_partition([[maybe_unused]] const std::vector<double>& level_weights) const
+        -> std::vector<ca_type>
     {
 #ifdef SAMURAI_WITH_MPI
+        using block_t = std::array<value_t, dim>;
+
         mpi::communicator world;
-        std::cout << world.rank() << ": ";
-        for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+        auto size = static_cast<std::size_t>(world.size());
+        auto rank = static_cast<std::size_t>(world.rank());
+
+        const std::size_t block_level = m_min_level;
+
+        auto block_of = [&](const auto& cell)
+        {
+            block_t block;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                block[d] = cell.indices[d] >> (cell.level - block_level);
+            }
+            return block;
+        };
+
+        // the Morton keys are computed from the minimum corner of the blocks of all the ranks
+        block_t local_origin;
+        local_origin.fill(std::numeric_limits<value_t>::max());
+        for_each_cell(m_cells[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          auto block = block_of(cell);
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              local_origin[d] = std::min(local_origin[d], block[d]);
+                          }
+                      });
+        block_t origin;
+        mpi::all_reduce(world, local_origin.data(), static_cast<int>(dim), origin.data(), mpi::minimum<value_t>());
+
+        auto key_of = [&](const block_t& block)
+        {
+            block_t shifted;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                shifted[d] = block[d] - origin[d];
+            }
+            return morton_key<dim>(shifted);
+        };
+
+        // weight of each local block
+        std::map<std::uint64_t, double> block_weights;
+        for_each_cell(m_cells[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          block_weights[key_of(block_of(cell))] += (cell.level < level_weights.size()) ? level_weights[cell.level] : 1.;
+                      });
+
+        std::vector<std::uint64_t> keys;
+        std::vector<double> prefix_weights(1, 0.);
+        keys.reserve(block_weights.size());
+        prefix_weights.reserve(block_weights.size() + 1);
+        for (const auto& [key, weight] : block_weights)
+        {
+            keys.push_back(key);
+            prefix_weights.push_back(prefix_weights.back() + weight);
+        }
+
+        double total_weight   = mpi::all_reduce(world, prefix_weights.back(), std::plus<double>());
+        std::uint64_t max_key = mpi::all_reduce(world, keys.empty() ? std::uint64_t(0) : keys.back(), mpi::maximum<std::uint64_t>());
+
+        // splitters[p - 1] is the smallest key such that the weight of the blocks of lower keys is at least p/size of the total weight
+        std::vector<std::uint64_t> lower(size - 1, 0);
+        std::vector<std::uint64_t> splitters(size - 1, max_key + 1);
+        std::vector<std::uint64_t> middles(size - 1);
+        std::vector<double> local_weights(size - 1);
+        std::vector<double> weights(size - 1);
+        while (lower != splitters)
         {
-            auto neighbour = m_mpi_neighbourhood[i_rank];
-            if (load_fluxes[i_rank] < 0) // must tranfer load to the neighbour
+            for (std::size_t p = 0; p < size - 1; ++p)
             {
+                middles[p]       = lower[p] + (splitters[p] - lower[p]) / 2;
+                auto n           = std::lower_bound(keys.begin(), keys.end(), middles[p]) - keys.begin();
+                local_weights[p] = prefix_weights[static_cast<std::size_t>(n)];
             }
-            else if (load_fluxes[i_rank] > 0) // must receive load from the neighbour
+            mpi::all_reduce(world, local_weights.data(), static_cast<int>(size - 1), weights.data(), std::plus<double>());
+            for (std::size_t p = 0; p < size - 1; ++p)
             {
+                if (lower[p] == splitters[p])
+                {
+                    continue;
+                }
+                if (weights[p] >= total_weight * static_cast<double>(p + 1) / static_cast<double>(size))
+                {
+                    splitters[p] = middles[p];
+                }
+                else
+                {
+                    lower[p] = middles[p] + 1;
+                }
             }
-            std::cout << "--> " << neighbour.rank << ": " << load_fluxes[i_rank] << ", ";
         }
-        std::cout << std::endl;
+
+        std::vector<cl_type> cl(size);
+        for_each_cell(m_cells[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          auto key         = key_of(block_of(cell));
+                          auto destination = static_cast<std::size_t>(std::upper_bound(splitters.begin(), splitters.end(), key)
+                                                                       - splitters.begin());
+                          if (destination != rank)
+                          {
+                              cl[destination][cell.level].add_cell(cell);
+                          }
+                      });
+
+        std::vector<ca_type> cells_to_send(size);
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            cells_to_send[r] = {cl[r]};
+        }
+        return cells_to_send;
+#else
+        return {};
 #endif
     }
 
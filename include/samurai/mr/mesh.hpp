@@ -30,18 +30,20 @@ namespace samurai
     };
 
     template <std::size_t dim_,
-              std::size_t max_stencil_width_    = default_config::ghost_width,
-              std::size_t graduation_width_     = default_config::graduation_width,
-              std::size_t prediction_order_     = default_config::prediction_order,
-              std::size_t max_refinement_level_ = default_config::max_level,
-              class TInterval                   = default_config::interval_t>
+              std::size_t max_stencil_width_     = default_config::ghost_width,
+              std::size_t graduation_width_      = default_config::graduation_width,
+              std::size_t prediction_order_      = default_config::prediction_order,
+              std::size_t max_refinement_level_  = default_config::max_level,
+              class TInterval                    = default_config::interval_t,
+              CellListBackend cell_list_backend_ = default_config::cell_list_backend>
     struct MRConfig
     {
-        static constexpr std::size_t dim                  = dim_;
-        static constexpr std::size_t max_refinement_level = max_refinement_level_;
-        static constexpr int max_stencil_width            = max_stencil_width_;
-        static constexpr std::size_t graduation_width     = graduation_width_;
-        static constexpr int prediction_order             = prediction_order_;
+        static constexpr std::size_t dim                   = dim_;
+        static constexpr std::size_t max_refinement_level  = max_refinement_level_;
+        static constexpr int max_stencil_width             = max_stencil_width_;
+        static constexpr std::size_t graduation_width      = graduation_width_;
+        static constexpr int prediction_order              = prediction_order_;
+        static constexpr CellListBackend cell_list_backend = cell_list_backend_;
 
         // static constexpr int ghost_width = std::max(std::max(2 *
         // static_cast<int>(graduation_width) - 1,
@@ -73,6 +75,7 @@ namespace samurai
 
         MRMesh() = default;
         MRMesh(const cl_type& cl, const self_type& ref_mesh);
+        MRMesh(const ca_type& ca, const self_type& ref_mesh);
         MRMesh(const cl_type& cl, std::size_t min_level, std::size_t max_level);
         MRMesh(const samurai::Box<double, dim>& b, std::size_t min_level, std::size_t max_level);
         MRMesh(const samurai::Box<double, dim>& b, std::size_t min_level, std::size_t max_level, const std::array<bool, dim>& periodic);
@@ -89,6 +92,12 @@ namespace samurai
     {
     }
 
+    template <class Config>
+    inline MRMesh<Config>::MRMesh(const ca_type& ca, const self_type& ref_mesh)
+        : base_type(ca, ref_mesh)
+    {
+    }
+
     template <class Config>
     inline MRMesh<Config>::MRMesh(const cl_type& cl, std::size_t min_level, std::size_t max_level)
         : base_type(cl, min_level, max_level)
@@ -141,18 +150,23 @@ namespace samurai
         //
         // level 0 |.......|-------|.......|       |.......|-------|.......|
         //
-        for_each_interval(
-            this->cells()[mesh_id_t::cells],
-            [&](std::size_t level, const auto& interval, const auto& index_yz)
-            {
-                lcl_type& lcl = cell_list[level];
-                static_nested_loop<dim - 1, -config::max_stencil_width, config::max_stencil_width + 1>(
-                    [&](auto stencil)
-                    {
-                        auto index = xt::eval(index_yz + stencil);
-                        lcl[index].add_interval({interval.start - config::max_stencil_width, interval.end + config::max_stencil_width});
-                    });
-            });
+        // The ghost cells of a level only depend on the cells of this level
+#pragma omp parallel for schedule(dynamic)
+        for (std::size_t level = min_level; level <= max_level; ++level)
+        {
+            lcl_type& lcl = cell_list[level];
+            for_each_interval(
+                this->cells()[mesh_id_t::cells][level],
+                [&](std::size_t, const auto& interval, const auto& index_yz)
+                {
+                    static_nested_loop<dim - 1, -config::max_stencil_width, config::max_stencil_width + 1>(
+                        [&](auto stencil)
+                        {
+                            auto index = xt::eval(index_yz + stencil);
+                            lcl[index].add_interval({interval.start - config::max_stencil_width, interval.end + config::max_stencil_width});
+                        });
+                });
+        }
         this->cells()[mesh_id_t::cells_and_ghosts] = {cell_list, false};
 
         // Add cells for the MRA
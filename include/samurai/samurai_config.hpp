@@ -7,9 +7,65 @@ namespace samurai
 {
     static constexpr bool disable_color = true;
 
+    /// Use the search accelerator of the LevelCellArray (see IntervalSearch) in find(). It copies the bounds of the
+    /// intervals, i.e. about a third of the memory of the intervals with the default index type, but only for the
+    /// levels where find() is called, and it speeds up the stencil lookups of the operators on large meshes.
+    static constexpr bool enable_search_accelerator = true;
+
+    /// Above this proportion of refined or coarsened cells, update_field() rebuilds the mesh from a CellList.
+    /// Below it, only the cells are patched: each changed level is still computed with a union and a difference
+    /// over the whole level, and the new mesh still rebuilds all its sub-meshes (ghosts, projection cells, ...).
+    static constexpr double incremental_update_max_ratio = 0.25;
+
+    /// Above this ratio between the maximum and the average load minus one, load_balance() migrates cells between the ranks
+    static constexpr double load_balancing_max_imbalance = 0.05;
+
+    /// Number of iterations of the diffusion computing the load to transfer between neighbouring ranks
+    static constexpr std::size_t load_balancing_iterations = 10;
+
+    /// Number of chunks of cells given to each thread by the loops run with Run::Parallel
+    static constexpr std::size_t parallel_chunks_per_thread = 4;
+
+    /// Maximum number of released field containers kept by the StoragePool for reuse (0 disables the pool)
+    static constexpr std::size_t storage_pool_max_buffers = 16;
+
+    /// Maximum total size in bytes of the released field containers kept by the StoragePool. This memory stays
+    /// allocated in each process until it is reused or storage_pool<Container>().clear() is called
+    static constexpr std::size_t storage_pool_max_bytes = std::size_t(128) << 20;
+
+    /// Number of mesh versions whose interface plans are kept by the interface loops (0 disables the cache)
+    static constexpr std::size_t interface_plan_cache_size = 4;
+
+    /// Number of mesh versions whose ghost update plans are kept by update_ghost_mr() (0 disables the cache)
+    static constexpr std::size_t ghost_update_plan_cache_size = 4;
+
+    /// Maximum number of buffers of the exchanges with the neighbouring subdomains (with their persistent MPI requests) kept for reuse
+    static constexpr std::size_t subdomain_exchange_max_buffers = 32;
+
     template <class TValue, class TIndex>
     struct Interval;
 
+    /// Storage used by the LevelCellList to gather the intervals of a level
+    enum class CellListBackend
+    {
+        map, ///< nested std::map ending with a forward list of intervals
+        flat ///< hashed (y, z) rows with contiguous interval storage
+    };
+
+    /// Initial partition of the domain between the MPI ranks
+    enum class PartitionMethod
+    {
+        cartesian,          ///< Cartesian grid of boxes (space_filling_curve if the number of ranks can't be factorized accordingly)
+        space_filling_curve ///< parts of the same number of cells along the Morton curve
+    };
+
+    /// Migration of the cells performed by load_balance()
+    enum class LoadBalancingMethod
+    {
+        diffusion,          ///< cells exchanged with the neighbouring subdomains (see Mesh_base::load_balancing())
+        space_filling_curve ///< new partition of the cells along the Morton curve (see Mesh_base::space_filling_curve_partition())
+    };
+
     namespace default_config
     {
         static constexpr std::size_t max_level        = 20;
@@ -17,8 +73,17 @@ namespace samurai
         static constexpr std::size_t graduation_width = 1;
         static constexpr std::size_t prediction_order = 1;
 
+        static constexpr CellListBackend cell_list_backend         = CellListBackend::map;
+        static constexpr PartitionMethod partition_method          = PartitionMethod::cartesian;
+        static constexpr LoadBalancingMethod load_balancing_method = LoadBalancingMethod::diffusion;
+
         using index_t    = signed long long int;
         using value_t    = int;
         using interval_t = Interval<value_t, index_t>;
+
+        /// 32-bit storage index: the intervals take 16 bytes instead of 24,
+        /// but a mesh can't have more than 2^31 cells (checked by update_index())
+        using compact_index_t    = int;
+        using compact_interval_t = Interval<value_t, compact_index_t>;
     }
 }
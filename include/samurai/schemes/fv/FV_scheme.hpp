@@ -190,6 +190,25 @@ namespace samurai
             explicit_scheme.apply(d, output_field, input_field);
         }
 
+        /**
+         * output_field = alpha * input_field + beta * scheme(input_field), computed without temporary field
+         */
+        void apply_axpy(output_field_t& output_field, double alpha, input_field_t& input_field, double beta) const
+        {
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.apply_axpy(output_field, alpha, input_field, beta);
+        }
+
+        /**
+         * Same as apply(), where the ghosts of input_field are exchanged with the neighbouring subdomains during the computation
+         * (see ExplicitFVScheme::apply_with_ghost_exchange())
+         */
+        void apply_with_ghost_exchange(output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.apply_with_ghost_exchange(output_field, input_field);
+        }
+
         /**
          * Helper functions to get coefficients from a set of matrices
          */
@@ -36,6 +36,15 @@ namespace samurai
 
         void apply(output_field_t& output_field, input_field_t& input_field) const override
         {
+            // the stencils are not split with respect to the subdomain halo (see apply_with_ghost_exchange()):
+            // all of them are computed once the ghosts are complete
+            if (detail::interface_selection() == InterfaceSelection::away_from_halo)
+            {
+                return;
+            }
+
+            double scale = this->contribution_scale();
+
             scheme().for_each_stencil_and_coeffs(
                 input_field,
                 [&](const auto& cells, const auto& coeffs)
@@ -46,7 +55,7 @@ namespace samurai
                         {
                             for (std::size_t c = 0; c < stencil_size; ++c)
                             {
-                                double coeff = this->scheme().cell_coeff(coeffs, c, field_i, field_j);
+                                double coeff = scale * this->scheme().cell_coeff(coeffs, c, field_i, field_j);
                                 field_value(output_field, cells[center_index], field_i) += coeff
                                                                                          * field_value(input_field, cells[c], field_j);
                             }
@@ -84,13 +93,22 @@ namespace samurai
 
         void apply(output_field_t& output_field, input_field_t& input_field) const override
         {
+            // the stencils are not split with respect to the subdomain halo (see apply_with_ghost_exchange()):
+            // all of them are computed once the ghosts are complete
+            if (detail::interface_selection() == InterfaceSelection::away_from_halo)
+            {
+                return;
+            }
+
+            double scale = this->contribution_scale();
+
             scheme().for_each_stencil_center(
                 input_field,
                 [&](const auto& stencil_center, auto& contrib)
                 {
                     for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
                     {
-                        field_value(output_field, stencil_center, field_i) += this->scheme().contrib_cmpnent(contrib, field_i);
+                        field_value(output_field, stencil_center, field_i) += scale * this->scheme().contrib_cmpnent(contrib, field_i);
                     }
                 });
         }
@@ -1,4 +1,6 @@
 #pragma once
+#include "../../algorithm/update.hpp"
+#include "../../interface.hpp"
 #include "../explicit_scheme.hpp"
 #include "FV_scheme.hpp"
 
@@ -22,6 +24,9 @@ namespace samurai
 
         const scheme_t* m_scheme = nullptr;
 
+        // Factor applied to the contributions added to the output field (see apply_axpy())
+        double m_contribution_scale = 1;
+
       public:
 
         explicit ExplicitFVScheme(const scheme_t& scheme)
@@ -38,6 +43,16 @@ namespace samurai
             return *m_scheme;
         }
 
+        double contribution_scale() const
+        {
+            return m_contribution_scale;
+        }
+
+        void set_contribution_scale(double scale)
+        {
+            m_contribution_scale = scale;
+        }
+
       protected:
 
         output_field_t create_output_field(input_field_t& input_field) const
@@ -69,6 +84,48 @@ namespace samurai
             return output_field;
         }
 
+        /**
+         * Computes output_field = alpha * input_field + beta * scheme(input_field) into the already allocated output_field:
+         * no temporary field is created, and the contributions of the scheme are added, already scaled by beta,
+         * in the same sweep as their computation.
+         */
+        void apply_axpy(output_field_t& output_field, double alpha, input_field_t& input_field, double beta)
+        {
+            static_assert(output_field_t::size == input_field_t::size,
+                          "apply_axpy() requires the same number of components in the input and output fields.");
+            assert(static_cast<const void*>(&output_field) != static_cast<const void*>(&input_field)
+                   && "apply_axpy() cannot be computed in place.");
+
+            output_field.array() = alpha * input_field.array();
+
+            if (beta != 0)
+            {
+                double scale = m_contribution_scale;
+                m_contribution_scale *= beta;
+                apply(output_field, input_field);
+                m_contribution_scale = scale;
+            }
+        }
+
+        /**
+         * Same as apply(), where the ghosts of @param input_field are updated during the computation (see begin_ghost_exchange()):
+         * the contributions of the interfaces whose stencil does not touch the halo of the subdomain are computed
+         * while the ghosts of the neighbouring subdomains are exchanged, the other ones once the exchange is complete.
+         * The ghosts of @param input_field must not be updated beforehand.
+         */
+        void apply_with_ghost_exchange(output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto exchange = begin_ghost_exchange(input_field);
+            {
+                detail::ScopedInterfaceSelection selection(InterfaceSelection::away_from_halo);
+                apply(output_field, input_field);
+            }
+            end_ghost_exchange(exchange);
+
+            detail::ScopedInterfaceSelection selection(InterfaceSelection::near_halo);
+            apply(output_field, input_field);
+        }
+
         virtual void apply(output_field_t& output_field, input_field_t& input_field) const
         {
             for (std::size_t d = 0; d < dim; ++d)
@@ -4,6 +4,107 @@
 
 namespace samurai
 {
+    namespace detail
+    {
+        /**
+         * Fused evaluation of the operators of a sum (see @class Explicit<OperatorSum>):
+         * each operator adds its fluxes to the ones of the other operators at the current interface.
+         */
+
+        // Operator without flux (e.g. a CellBasedScheme): it is applied separately
+        struct NoFusedFlux
+        {
+            bool include_boundary_fluxes = false;
+
+            void set_flux_length(double)
+            {
+            }
+        };
+
+        template <class FluxValue>
+        inline auto& flux_component(FluxValue& flux_value, [[maybe_unused]] std::size_t field_i)
+        {
+            if constexpr (std::is_floating_point_v<FluxValue>)
+            {
+                return flux_value;
+            }
+            else
+            {
+                return flux_value(field_i);
+            }
+        }
+
+        template <class FluxFunction>
+        struct NonLinearFusedFlux
+        {
+            const FluxFunction& flux_function;
+            bool include_boundary_fluxes;
+
+            void set_flux_length(double)
+            {
+            }
+
+            template <class Cells, class Field, class FluxPair>
+            void add_to(Cells& cells, const Field& field, FluxPair& fluxes) const
+            {
+                auto flux_values = flux_function(cells, field);
+                fluxes[0] += flux_values[0];
+                fluxes[1] += flux_values[1];
+            }
+        };
+
+        template <class Scheme>
+        struct LinearFusedFlux
+        {
+            using cfg = typename Scheme::cfg_t;
+
+            const Scheme& scheme;
+            const NormalFluxDefinition<cfg>& flux_definition;
+            bool include_boundary_fluxes;
+            FluxStencilCoeffs<cfg> flux_coeffs; // linear homogeneous flux: coefficients at the current level
+
+            void set_flux_length(double h)
+            {
+                if constexpr (cfg::scheme_type == SchemeType::LinearHomogeneous)
+                {
+                    flux_coeffs = flux_definition.cons_flux_function(h);
+                }
+            }
+
+            template <class Cells, class Field, class FluxPair>
+            void add_to(Cells& cells, const Field& field, FluxPair& fluxes) const
+            {
+                if constexpr (cfg::scheme_type == SchemeType::LinearHeterogeneous)
+                {
+                    add_to(flux_definition.cons_flux_function(cells), cells, field, fluxes);
+                }
+                else
+                {
+                    add_to(flux_coeffs, cells, field, fluxes);
+                }
+            }
+
+          private:
+
+            template <class Cells, class Field, class FluxPair>
+            void add_to(const FluxStencilCoeffs<cfg>& coeffs, Cells& cells, const Field& field, FluxPair& fluxes) const
+            {
+                for (std::size_t field_i = 0; field_i < cfg::output_field_size; ++field_i)
+                {
+                    for (std::size_t field_j = 0; field_j < Field::size; ++field_j)
+                    {
+                        for (std::size_t c = 0; c < cfg::stencil_size; ++c)
+                        {
+                            auto flux = scheme.cell_coeff(coeffs, c, field_i, field_j) * field_value(field, cells[c], field_j);
+                            flux_component(fluxes[0], field_i) += flux;
+                            flux_component(fluxes[1], field_i) -= flux;
+                        }
+                    }
+                }
+            }
+        };
+    }
+
     template <class... Operators>
     class Explicit<OperatorSum<Operators...>> : public ExplicitFVScheme<OperatorSum<Operators...>>
     {
@@ -14,8 +115,48 @@ namespace samurai
         using scheme_t       = typename base_class::scheme_t;
         using input_field_t  = typename base_class::input_field_t;
         using output_field_t = typename base_class::output_field_t;
+        using base_class::dim;
         using base_class::scheme;
 
+      private:
+
+        using cell_t       = typename input_field_t::cell_t;
+        using mesh_id_t    = typename input_field_t::mesh_t::mesh_id_t;
+        using flux_value_t = CollapsArray<typename input_field_t::value_type, scheme_t::output_field_size>;
+        using flux_pair_t  = std::array<flux_value_t, 2>;
+
+        static constexpr std::size_t n_operators      = sizeof...(Operators);
+        static constexpr std::size_t n_flux_operators = (std::size_t{is_FluxBasedScheme_v<Operators>} + ...);
+
+        template <class Operator>
+        static constexpr std::size_t flux_stencil_size()
+        {
+            if constexpr (is_FluxBasedScheme_v<Operator>)
+            {
+                return Operator::cfg_t::stencil_size;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        // The fused stencil is the concatenation of the stencils of the flux-based operators
+        static constexpr std::array<std::size_t, n_operators> stencil_sizes = {flux_stencil_size<Operators>()...};
+        static constexpr std::size_t fused_stencil_size                     = (flux_stencil_size<Operators>() + ...);
+
+        static constexpr std::size_t stencil_offset(std::size_t k)
+        {
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                offset += stencil_sizes[i];
+            }
+            return offset;
+        }
+
+      public:
+
         explicit Explicit(const scheme_t& sum_scheme)
             : base_class(sum_scheme)
         {
@@ -23,21 +164,305 @@ namespace samurai
 
         void apply(output_field_t& output_field, input_field_t& input_field) const override
         {
+            if (fused())
+            {
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    _apply_fused_fluxes(d, output_field, input_field);
+                }
+                for_each(scheme().operators(),
+                         [&](const auto& op)
+                         {
+                             if constexpr (!is_FluxBasedScheme_v<std::decay_t<decltype(op)>>)
+                             {
+                                 _apply_operator(op, output_field, input_field);
+                             }
+                         });
+                return;
+            }
+
             for_each(scheme().operators(),
                      [&](const auto& op)
                      {
-                         op.apply(output_field, input_field);
+                         _apply_operator(op, output_field, input_field);
                      });
         }
 
         void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) const override
         {
+            if (fused())
+            {
+                _apply_fused_fluxes(d, output_field, input_field);
+                for_each(scheme().operators(),
+                         [&](const auto& op)
+                         {
+                             if constexpr (!is_FluxBasedScheme_v<std::decay_t<decltype(op)>>)
+                             {
+                                 _apply_operator(op, d, output_field, input_field);
+                             }
+                         });
+                return;
+            }
+
             for_each(scheme().operators(),
                      [&](const auto& op)
                      {
-                         op.apply(d, output_field, input_field);
+                         _apply_operator(op, d, output_field, input_field);
                      });
         }
+
+      private:
+
+        /**
+         * Applies one operator of the sum, with the same contribution scale as the sum (see apply_axpy()).
+         */
+        template <class Operator>
+        void _apply_operator(const Operator& op, output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto explicit_op = make_explicit(op);
+            explicit_op.set_contribution_scale(this->contribution_scale());
+            explicit_op.apply(output_field, input_field);
+        }
+
+        template <class Operator>
+        void _apply_operator(const Operator& op, std::size_t d, output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto explicit_op = make_explicit(op);
+            explicit_op.set_contribution_scale(this->contribution_scale());
+            explicit_op.apply(d, output_field, input_field);
+        }
+
+        bool fused() const
+        {
+            // nothing to fuse with less than two flux-based operators
+            return scheme().fused_evaluation() && n_flux_operators >= 2;
+        }
+
+        /**
+         * Calls @param f with the tuple of the fused fluxes of the operators (one per operator) in the direction d.
+         */
+        template <std::size_t k = 0, class Func, class... FusedFluxes>
+        void with_fused_fluxes(std::size_t d, Func&& f, FusedFluxes... fused_fluxes) const
+        {
+            if constexpr (k == n_operators)
+            {
+                auto fluxes = std::tie(fused_fluxes...);
+                f(fluxes);
+            }
+            else
+            {
+                const auto& op = std::get<k>(scheme().operators());
+                using op_t     = std::decay_t<decltype(op)>;
+
+                if constexpr (!is_FluxBasedScheme_v<op_t>)
+                {
+                    with_fused_fluxes<k + 1>(d, f, fused_fluxes..., detail::NoFusedFlux{});
+                }
+                else if constexpr (op_t::cfg_t::scheme_type == SchemeType::NonLinear)
+                {
+                    op.with_flux_function(d,
+                                          [&](const auto& flux_function)
+                                          {
+                                              using flux_function_t = std::decay_t<decltype(flux_function)>;
+                                              detail::NonLinearFusedFlux<flux_function_t> fused_flux{flux_function,
+                                                                                                     op.include_boundary_fluxes()};
+                                              with_fused_fluxes<k + 1>(d, f, fused_fluxes..., fused_flux);
+                                          });
+                }
+                else
+                {
+                    detail::LinearFusedFlux<op_t> fused_flux{op, op.flux_definition()[d], op.include_boundary_fluxes(), {}};
+                    with_fused_fluxes<k + 1>(d, f, fused_fluxes..., fused_flux);
+                }
+            }
+        }
+
+        template <std::size_t offset, std::size_t size, class Cells>
+        static CollapsStdArray<cell_t, size> operator_cells(const Cells& fused_cells)
+        {
+            if constexpr (size == 1)
+            {
+                return fused_cells[offset];
+            }
+            else
+            {
+                std::array<cell_t, size> cells;
+                for (std::size_t c = 0; c < size; ++c)
+                {
+                    cells[c] = fused_cells[offset + c];
+                }
+                return cells;
+            }
+        }
+
+        /**
+         * Sum of the fluxes of the operators at the interface whose fused stencil is @param fused_cells.
+         */
+        template <class FusedFluxes, class Cells>
+        flux_pair_t sum_of_fluxes(FusedFluxes& fused_fluxes, const Cells& fused_cells, input_field_t& field, bool boundary = false) const
+        {
+            flux_pair_t fluxes;
+            fluxes[0] = zeros<flux_value_t>();
+            fluxes[1] = zeros<flux_value_t>();
+
+            static_for<0, n_operators>::apply(
+                [&](auto integral_constant_k)
+                {
+                    static constexpr std::size_t k = decltype(integral_constant_k)::value;
+
+                    if constexpr (stencil_sizes[k] > 0)
+                    {
+                        auto& fused_flux = std::get<k>(fused_fluxes);
+                        if (!boundary || fused_flux.include_boundary_fluxes)
+                        {
+                            auto cells = operator_cells<stencil_offset(k), stencil_sizes[k]>(fused_cells);
+                            fused_flux.add_to(cells, field, fluxes);
+                        }
+                    }
+                });
+            return fluxes;
+        }
+
+        void add_flux(output_field_t& output_field, const cell_t& cell, const flux_value_t& flux, double factor) const
+        {
+            for (std::size_t field_i = 0; field_i < scheme_t::output_field_size; ++field_i)
+            {
+                field_value(output_field, cell, field_i) += factor * detail::flux_component(flux, field_i);
+            }
+        }
+
+        /**
+         * Browses the interfaces once for all the flux-based operators of the sum:
+         * the operators evaluate their fluxes on the concatenation of their stencils, and the sum is added to the cells.
+         */
+        void _apply_fused_fluxes(std::size_t d, output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto& mesh = input_field.mesh();
+
+            auto min_level = mesh[mesh_id_t::cells].min_level();
+            auto max_level = mesh[mesh_id_t::cells].max_level();
+
+            DirectionVector<dim> direction;
+            Stencil<fused_stencil_size, dim> fused_stencil;
+            std::size_t row = 0;
+            for_each(scheme().operators(),
+                     [&](const auto& op)
+                     {
+                         if constexpr (is_FluxBasedScheme_v<std::decay_t<decltype(op)>>)
+                         {
+                             auto& flux_def = op.flux_definition()[d];
+                             direction      = flux_def.direction;
+                             for (std::size_t c = 0; c < flux_def.stencil.shape(0); ++c, ++row)
+                             {
+                                 xt::view(fused_stencil, row) = xt::view(flux_def.stencil, c);
+                             }
+                         }
+                     });
+
+            double scale = this->contribution_scale();
+
+            auto factor = [&](double h_face, double h_cell)
+            {
+                return scale * std::pow(h_face, dim - 1) / std::pow(h_cell, dim);
+            };
+
+            auto set_flux_length = [](auto& fused_fluxes, double h)
+            {
+                for_each(fused_fluxes,
+                         [&](auto& fused_flux)
+                         {
+                             fused_flux.set_flux_length(h);
+                         });
+            };
+
+            with_fused_fluxes(
+                d,
+                [&](auto& fused_fluxes)
+                {
+                    // Interior interfaces: the interfaces sharing a cell are never processed concurrently (no atomics needed)
+
+                    // Same level
+                    for (std::size_t level = min_level; level <= max_level; ++level)
+                    {
+                        auto h = cell_length(level);
+                        set_flux_length(fused_fluxes, h);
+
+                        for_each_interior_interface__same_level<Run::ParallelColored>(
+                            mesh,
+                            level,
+                            direction,
+                            fused_stencil,
+                            [&](auto& interface_cells, auto& comput_cells)
+                            {
+                                auto fluxes = sum_of_fluxes(fused_fluxes, comput_cells, input_field);
+                                add_flux(output_field, interface_cells[0], fluxes[0], factor(h, h));
+                                add_flux(output_field, interface_cells[1], fluxes[1], factor(h, h));
+                            });
+                    }
+
+                    // Level jumps (level -- level+1): the fluxes are computed at level+1
+                    for (std::size_t level = min_level; level < max_level; ++level)
+                    {
+                        auto h_l   = cell_length(level);
+                        auto h_lp1 = cell_length(level + 1);
+                        set_flux_length(fused_fluxes, h_lp1);
+
+                        for_each_interior_interface__level_jump_direction<Run::ParallelColored>(
+                            mesh,
+                            level,
+                            direction,
+                            fused_stencil,
+                            [&](auto& interface_cells, auto& comput_cells)
+                            {
+                                auto fluxes = sum_of_fluxes(fused_fluxes, comput_cells, input_field);
+                                add_flux(output_field, interface_cells[0], fluxes[0], factor(h_lp1, h_l));
+                                add_flux(output_field, interface_cells[1], fluxes[1], factor(h_lp1, h_lp1));
+                            });
+
+                        for_each_interior_interface__level_jump_opposite_direction<Run::ParallelColored>(
+                            mesh,
+                            level,
+                            direction,
+                            fused_stencil,
+                            [&](auto& interface_cells, auto& comput_cells)
+                            {
+                                auto fluxes = sum_of_fluxes(fused_fluxes, comput_cells, input_field);
+                                add_flux(output_field, interface_cells[0], fluxes[0], factor(h_lp1, h_lp1));
+                                add_flux(output_field, interface_cells[1], fluxes[1], factor(h_lp1, h_l));
+                            });
+                    }
+
+                    // Boundary interfaces
+                    for_each_level(mesh,
+                                   [&](auto level)
+                                   {
+                                       auto h = cell_length(level);
+                                       set_flux_length(fused_fluxes, h);
+
+                                       for_each_boundary_interface__direction<Run::Parallel>(
+                                           mesh,
+                                           level,
+                                           direction,
+                                           fused_stencil,
+                                           [&](auto& cell, auto& comput_cells)
+                                           {
+                                               auto fluxes = sum_of_fluxes(fused_fluxes, comput_cells, input_field, true);
+                                               add_flux(output_field, cell, fluxes[0], factor(h, h));
+                                           });
+
+                                       for_each_boundary_interface__opposite_direction<Run::Parallel>(
+                                           mesh,
+                                           level,
+                                           direction,
+                                           fused_stencil,
+                                           [&](auto& cell, auto& comput_cells)
+                                           {
+                                               auto fluxes = sum_of_fluxes(fused_fluxes, comput_cells, input_field, true);
+                                               add_flux(output_field, cell, fluxes[1], factor(h, h));
+                                           });
+                                   });
+                });
+        }
     };
 
 } // end namespace samurai
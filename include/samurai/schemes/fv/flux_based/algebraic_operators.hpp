@@ -35,7 +35,14 @@ namespace samurai
                     }
                     else // SchemeType::NonLinear
                     {
-                        if (scheme.flux_definition()[d].cons_flux_function)
+                        if (auto* static_flux = static_flux_function<d>(scheme.flux_definition()[d]))
+                        {
+                            // Keep the compile-time type of the flux, so that the explicit application can still inline it
+                            auto multiplied_flux = *static_flux;
+                            multiplied_flux.scale *= scalar;
+                            multiplied_scheme.flux_definition()[d].cons_flux_function = multiplied_flux;
+                        }
+                        else if (scheme.flux_definition()[d].cons_flux_function)
                         {
                             multiplied_scheme.flux_definition()[d].cons_flux_function = [=](auto& cells, const auto& field)
                             {
@@ -49,6 +56,17 @@ namespace samurai
                                 return scalar * scheme.flux_definition()[d].flux_function(cells, field);
                             };
                         }
+                        if (scheme.flux_definition()[d].cons_interval_flux_function())
+                        {
+                            // set after 'cons_flux_function', whose assignment drops the interval flux
+                            multiplied_scheme.flux_definition()[d].set_cons_interval_flux_function(
+                                [=](const auto& values)
+                                {
+                                    const auto& interval_flux     = scheme.flux_definition()[d].cons_interval_flux_function();
+                                    IntervalFluxValue<cfg> fluxes = scalar * interval_flux(values);
+                                    return fluxes;
+                                });
+                        }
                         if (scheme.flux_definition()[d].cons_jacobian_function)
                         {
                             multiplied_scheme.flux_definition()[d].cons_jacobian_function = [=](auto& cells, const auto& field)
@@ -126,6 +144,23 @@ namespace samurai
                         assert(false && "The case where scheme1.flux_function and scheme2.cons_flux_function are set is not implemented.");
                     }
 
+                    if (scheme1.flux_definition()[d].cons_interval_flux_function()
+                        && scheme2.flux_definition()[d].cons_interval_flux_function())
+                    {
+                        sum_scheme.flux_definition()[d].set_cons_interval_flux_function(
+                            [=](const auto& values)
+                            {
+                                IntervalFluxValue<cfg> fluxes = scheme1.flux_definition()[d].cons_interval_flux_function()(values)
+                                                              + scheme2.flux_definition()[d].cons_interval_flux_function()(values);
+                                return fluxes;
+                            });
+                    }
+                    else
+                    {
+                        // the sum is computed cell by cell
+                        sum_scheme.flux_definition()[d].set_cons_interval_flux_function(nullptr);
+                    }
+
                     if (scheme1.flux_definition()[d].jacobian_function && scheme2.flux_definition()[d].jacobian_function)
                     {
                         sum_scheme.flux_definition()[d].jacobian_function = [=](auto& cells, const auto& field)
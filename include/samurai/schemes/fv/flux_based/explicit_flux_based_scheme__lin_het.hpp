@@ -45,6 +45,8 @@ namespace samurai
             // Vec vec_res = petsc::create_petsc_vector_from(output_field);
             // MatMult(A, vec_f, vec_res);
 
+            double scale = this->contribution_scale();
+
             // Interior interfaces
             scheme().for_each_interior_interface_and_coeffs(
                 d,
@@ -65,8 +67,8 @@ namespace samurai
                                     assert(false);
                                 }
 #endif
-                                double left_cell_coeff  = this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
-                                double right_cell_coeff = this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
+                                double left_cell_coeff  = scale * this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
+                                double right_cell_coeff = scale * this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
                                 field_value(output_field, interface_cells[0], field_i) += left_cell_coeff
                                                                                         * field_value(input_field, comput_cells[c], field_j);
                                 field_value(output_field, interface_cells[1], field_i) += right_cell_coeff
@@ -98,7 +100,7 @@ namespace samurai
                                         assert(false);
                                     }
 #endif
-                                    double coeff = this->scheme().cell_coeff(coeffs, c, field_i, field_j);
+                                    double coeff = scale * this->scheme().cell_coeff(coeffs, c, field_i, field_j);
                                     field_value(output_field, cell, field_i) += coeff * field_value(input_field, comput_cells[c], field_j);
                                 }
                             }
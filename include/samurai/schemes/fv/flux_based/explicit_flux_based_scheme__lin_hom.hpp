@@ -52,6 +52,8 @@ namespace samurai
 
             using index_t = decltype(left_cell_index_init);
 
+            double scale = this->contribution_scale();
+
             for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
             {
                 for (std::size_t field_j = 0; field_j < field_size; ++field_j)
@@ -60,8 +62,8 @@ namespace samurai
                     {
                         index_t comput_index_init = stencil.cells()[c].index;
 
-                        auto left_cell_coeff  = this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
-                        auto right_cell_coeff = this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
+                        auto left_cell_coeff  = scale * this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
+                        auto right_cell_coeff = scale * this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
 
                         // clang-format off
                         if (left_cell.level == right_cell.level || i.size() == 1) // if same level, or a jump in the x-direction (<=> i.size()=1)
@@ -140,6 +142,8 @@ namespace samurai
             std::vector<value_t> left_contributions(n_left_cells, 0);
             std::vector<value_t> right_contributions(n_right_cells, 0);
 
+            double scale = this->contribution_scale();
+
             for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
             {
                 // We first accumulate the contributions in a SIMD fashion into local vectors,
@@ -154,8 +158,8 @@ namespace samurai
                     {
                         index_t comput_index_init = stencil.cells()[c].index;
 
-                        auto left_cell_coeff  = this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
-                        auto right_cell_coeff = this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
+                        auto left_cell_coeff  = scale * this->scheme().cell_coeff(left_cell_coeffs, c, field_i, field_j);
+                        auto right_cell_coeff = scale * this->scheme().cell_coeff(right_cell_coeffs, c, field_i, field_j);
 
                         // clang-format off
                         if (left_cell.level == right_cell.level || i.size() == 1) // if same level, or a jump in the x-direction (<=> i.size()=1)
@@ -227,22 +231,8 @@ namespace samurai
             }
         }
 
-      public:
-
-        void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) const override
+        void _apply_interior_contributions_with_atomics(std::size_t d, output_field_t& output_field, input_field_t& input_field) const
         {
-            /**
-             * Implementation by matrix-vector multiplication
-             */
-            // Mat A;
-            // auto assembly = petsc::make_assembly(scheme());
-            // assembly.create_matrix(A);
-            // assembly.assemble_matrix(A);
-            // Vec vec_f   = petsc::create_petsc_vector_from(f);
-            // Vec vec_res = petsc::create_petsc_vector_from(output_field);
-            // MatMult(A, vec_f, vec_res);
-
-            // Interior interfaces
             scheme().template for_each_interior_interface_and_coeffs<Run::Parallel, Get::Intervals>(
                 d,
                 input_field,
@@ -266,10 +256,50 @@ namespace samurai
                     _apply_contribution_in_sequential_context(output_field, input_field, interface, stencil, left_cell_coeffs, right_cell_coeffs);
 #endif
                 });
+        }
+
+      public:
+
+        void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) const override
+        {
+            /**
+             * Implementation by matrix-vector multiplication
+             */
+            // Mat A;
+            // auto assembly = petsc::make_assembly(scheme());
+            // assembly.create_matrix(A);
+            // assembly.assemble_matrix(A);
+            // Vec vec_f   = petsc::create_petsc_vector_from(f);
+            // Vec vec_res = petsc::create_petsc_vector_from(output_field);
+            // MatMult(A, vec_f, vec_res);
+
+            // Interior interfaces
+            if (scheme().flux_accumulation() == FluxAccumulation::Colored)
+            {
+                // The interfaces sharing a cell are never processed concurrently: the sequential (SIMD) version is used
+                scheme().template for_each_interior_interface_and_coeffs<Run::ParallelColored, Get::Intervals>(
+                    d,
+                    input_field,
+                    [&](auto& interface, auto& stencil, auto& left_cell_coeffs, auto& right_cell_coeffs)
+                    {
+                        _apply_contribution_in_sequential_context(output_field,
+                                                                  input_field,
+                                                                  interface,
+                                                                  stencil,
+                                                                  left_cell_coeffs,
+                                                                  right_cell_coeffs);
+                    });
+            }
+            else
+            {
+                _apply_interior_contributions_with_atomics(d, output_field, input_field);
+            }
 
             // Boundary interfaces
             if (scheme().include_boundary_fluxes())
             {
+                double scale = this->contribution_scale();
+
                 scheme().template for_each_boundary_interface_and_coeffs<Run::Parallel, Get::Intervals>(
                     d,
                     input_field,
@@ -290,7 +320,7 @@ namespace samurai
                                         assert(false);
                                     }
 #endif
-                                    auto coeff = this->scheme().cell_coeff(coeffs, c, field_i, field_j);
+                                    auto coeff = scale * this->scheme().cell_coeff(coeffs, c, field_i, field_j);
                                     // field_value(output_field, cell, field_i) += coeff * field_value(input_field, stencil[c], field_j);
 
                                     auto cell_index_init   = cell.index;
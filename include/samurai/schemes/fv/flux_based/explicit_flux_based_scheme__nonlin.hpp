@@ -16,6 +16,7 @@ namespace samurai
         using scheme_t       = typename base_class::scheme_t;
         using input_field_t  = typename base_class::input_field_t;
         using output_field_t = typename base_class::output_field_t;
+        using index_t        = typename input_field_t::interval_t::index_t;
         using base_class::scheme;
 
         static constexpr std::size_t output_field_size = scheme_t::output_field_size;
@@ -29,25 +30,201 @@ namespace samurai
         {
         }
 
-        void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) const override
+      private:
+
+        /**
+         * Adds factor * fluxes to the cells stored contiguously from @param first_cell_index.
+         * If @param coarse_cells, each cell receives the fluxes of two consecutive (fine) interfaces.
+         */
+        template <bool atomic>
+        void _add_interval_contribution(output_field_t& output_field,
+                                        index_t first_cell_index,
+                                        bool coarse_cells,
+                                        const IntervalFluxValue<cfg>& fluxes,
+                                        double factor) const
         {
-            // Interior interfaces
-            scheme().template for_each_interior_interface<Run::Parallel>( // We need the 'template' keyword...
-                d,
-                input_field,
-                [&](const auto& interface_cells, auto& left_cell_contrib, auto& right_cell_contrib)
+            auto n_fluxes = static_cast<index_t>(fluxes.shape(0));
+
+            for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
+            {
+                auto flux = [&](index_t ii)
                 {
-                    for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
+                    if constexpr (output_field_size == 1)
+                    {
+                        return fluxes(static_cast<std::size_t>(ii));
+                    }
+                    else
                     {
-                    // clang-format off
-                        #pragma omp atomic update
-                        field_value(output_field, interface_cells[0], field_i) += this->scheme().flux_value_cmpnent(left_cell_contrib, field_i);
+                        return fluxes(static_cast<std::size_t>(ii), field_i);
+                    }
+                };
 
-                        #pragma omp atomic update
-                        field_value(output_field, interface_cells[1], field_i) += this->scheme().flux_value_cmpnent(right_cell_contrib, field_i);
-                        // clang-format on
+                // clang-format off
+                if (!coarse_cells)
+                {
+                    if constexpr (atomic)
+                    {
+                        for (index_t ii = 0; ii < n_fluxes; ++ii)
+                        {
+                            #pragma omp atomic update
+                            field_value(output_field, first_cell_index + ii, field_i) += factor * flux(ii);
+                        }
                     }
-                });
+                    else
+                    {
+                        #pragma omp simd
+                        for (index_t ii = 0; ii < n_fluxes; ++ii)
+                        {
+                            field_value(output_field, first_cell_index + ii, field_i) += factor * flux(ii);
+                        }
+                    }
+                }
+                else
+                {
+                    // Level jump: the fine interval is even, with two fine interfaces per coarse cell
+                    assert(n_fluxes % 2 == 0);
+                    if constexpr (atomic)
+                    {
+                        for (index_t ii = 0; ii < n_fluxes / 2; ++ii)
+                        {
+                            #pragma omp atomic update
+                            field_value(output_field, first_cell_index + ii, field_i) += factor * (flux(2*ii) + flux(2*ii+1));
+                        }
+                    }
+                    else
+                    {
+                        #pragma omp simd
+                        for (index_t ii = 0; ii < n_fluxes / 2; ++ii)
+                        {
+                            field_value(output_field, first_cell_index + ii, field_i) += factor * (flux(2*ii) + flux(2*ii+1));
+                        }
+                    }
+                }
+                // clang-format on
+            }
+        }
+
+        template <bool atomic, class InterfaceIterator>
+        void _add_interface_contributions(output_field_t& output_field,
+                                          InterfaceIterator& interface_it,
+                                          const IntervalFluxValue<cfg>& fluxes,
+                                          double left_factor,
+                                          double right_factor) const
+        {
+            auto& left_cell  = interface_it.cells()[0];
+            auto& right_cell = interface_it.cells()[1];
+
+            // Level jumps in the x-direction are made of intervals of size 1
+            bool level_jump   = left_cell.level != right_cell.level && interface_it.interval().size() > 1;
+            bool left_coarse  = level_jump && left_cell.level < right_cell.level;
+            bool right_coarse = level_jump && right_cell.level < left_cell.level;
+
+            _add_interval_contribution<atomic>(output_field, left_cell.index, left_coarse, fluxes, left_factor);
+            _add_interval_contribution<atomic>(output_field, right_cell.index, right_coarse, fluxes, right_factor);
+        }
+
+        /**
+         * Implementation of apply() where the fluxes are computed interval by interval (see set_cons_interval_flux_function()).
+         */
+        void _apply_interval_fluxes(std::size_t d, output_field_t& output_field, input_field_t& input_field) const
+        {
+            double scale = this->contribution_scale();
+
+            // Interior interfaces
+            if (scheme().flux_accumulation() == FluxAccumulation::Colored)
+            {
+                scheme().template for_each_interior_interface_interval<Run::ParallelColored>(
+                    d,
+                    input_field,
+                    [&](auto& interface_it, const auto& fluxes, double left_factor, double right_factor)
+                    {
+                        _add_interface_contributions<false>(output_field, interface_it, fluxes, scale * left_factor, scale * right_factor);
+                    });
+            }
+            else
+            {
+                scheme().template for_each_interior_interface_interval<Run::Parallel>(
+                    d,
+                    input_field,
+                    [&](auto& interface_it, const auto& fluxes, double left_factor, double right_factor)
+                    {
+#ifdef SAMURAI_WITH_OPENMP
+                        if (omp_get_max_threads() > 1)
+                        {
+                            _add_interface_contributions<true>(output_field,
+                                                               interface_it,
+                                                               fluxes,
+                                                               scale * left_factor,
+                                                               scale * right_factor);
+                            return;
+                        }
+#endif
+                        _add_interface_contributions<false>(output_field, interface_it, fluxes, scale * left_factor, scale * right_factor);
+                    });
+            }
+
+            // Boundary interfaces
+            if (scheme().include_boundary_fluxes())
+            {
+                scheme().template for_each_boundary_interface_interval<Run::Parallel>(
+                    d,
+                    input_field,
+                    [&](const auto& cell, const auto& fluxes, double factor)
+                    {
+                        _add_interval_contribution<false>(output_field, cell.index, false, fluxes, scale * factor);
+                    });
+            }
+        }
+
+      public:
+
+        void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) const override
+        {
+            if (scheme().has_interval_flux(d))
+            {
+                _apply_interval_fluxes(d, output_field, input_field);
+                return;
+            }
+
+            double scale = this->contribution_scale();
+
+            // Interior interfaces
+            if (scheme().flux_accumulation() == FluxAccumulation::Colored)
+            {
+                // The interfaces sharing a cell are never processed concurrently: no atomics needed
+                scheme().template for_each_interior_interface<Run::ParallelColored>( // We need the 'template' keyword...
+                    d,
+                    input_field,
+                    [&](const auto& interface_cells, auto& left_cell_contrib, auto& right_cell_contrib)
+                    {
+                        for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
+                        {
+                            auto left_value  = scale * this->scheme().flux_value_cmpnent(left_cell_contrib, field_i);
+                            auto right_value = scale * this->scheme().flux_value_cmpnent(right_cell_contrib, field_i);
+                            field_value(output_field, interface_cells[0], field_i) += left_value;
+                            field_value(output_field, interface_cells[1], field_i) += right_value;
+                        }
+                    });
+            }
+            else
+            {
+                scheme().template for_each_interior_interface<Run::Parallel>( // We need the 'template' keyword...
+                    d,
+                    input_field,
+                    [&](const auto& interface_cells, auto& left_cell_contrib, auto& right_cell_contrib)
+                    {
+                        for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
+                        {
+                        // clang-format off
+                            #pragma omp atomic update
+                            field_value(output_field, interface_cells[0], field_i) += scale * this->scheme().flux_value_cmpnent(left_cell_contrib, field_i);
+
+                            #pragma omp atomic update
+                            field_value(output_field, interface_cells[1], field_i) += scale * this->scheme().flux_value_cmpnent(right_cell_contrib, field_i);
+                            // clang-format on
+                        }
+                    });
+            }
 
             // Boundary interfaces
             if (scheme().include_boundary_fluxes())
@@ -59,7 +236,7 @@ namespace samurai
                     {
                         for (std::size_t field_i = 0; field_i < output_field_size; ++field_i)
                         {
-                            field_value(output_field, cell, field_i) += this->scheme().flux_value_cmpnent(contrib, field_i);
+                            field_value(output_field, cell, field_i) += scale * this->scheme().flux_value_cmpnent(contrib, field_i);
                         }
                     });
             }
@@ -6,6 +6,16 @@
 
 namespace samurai
 {
+    /**
+     * Accumulation of the interface contributions into the cells by the explicit schemes run in parallel.
+     */
+    enum class FluxAccumulation
+    {
+        Atomic, ///< the contributions are added with atomic instructions
+        Colored ///< the interfaces sharing a cell are never processed concurrently (see Run::ParallelColored): no atomics,
+                ///< and the result doesn't depend on the number of threads
+    };
+
     /**
      * @class FluxBasedScheme
      */
@@ -22,6 +32,28 @@ namespace samurai
         return FluxBasedScheme<cfg, bdry_cfg>(flux_definition);
     }
 
+    /**
+     * Non-linear scheme whose conservative flux is the callable @param flux, called for the direction d as
+     *           flux(std::integral_constant<std::size_t, d>{}, cells, field).
+     * Unlike the std::function of a FluxDefinition, its type is known by the scheme,
+     * so the explicit application can inline it in the loops over the interfaces.
+     */
+    template <class cfg, class Flux>
+    auto make_flux_based_scheme(const Flux& flux)
+    {
+        using static_cfg = StaticFluxConfig<cfg, Flux>;
+
+        FluxDefinition<static_cfg> flux_definition;
+        static_for<0, cfg::dim>::apply(
+            [&](auto integral_constant_d)
+            {
+                static constexpr std::size_t d        = decltype(integral_constant_d)::value;
+                flux_definition[d].cons_flux_function = DirectionalFlux<static_cfg, d>{flux};
+            });
+
+        return make_flux_based_scheme(flux_definition);
+    }
+
     /**
      * is_FluxBasedScheme
      */
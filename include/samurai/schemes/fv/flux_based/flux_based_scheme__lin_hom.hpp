@@ -28,7 +28,8 @@ namespace samurai
       private:
 
         FluxDefinition<cfg> m_flux_definition;
-        bool m_include_boundary_fluxes = true;
+        bool m_include_boundary_fluxes       = true;
+        FluxAccumulation m_flux_accumulation = FluxAccumulation::Atomic;
 
       public:
 
@@ -57,6 +58,16 @@ namespace samurai
             return m_include_boundary_fluxes;
         }
 
+        void set_flux_accumulation(FluxAccumulation flux_accumulation)
+        {
+            m_flux_accumulation = flux_accumulation;
+        }
+
+        FluxAccumulation flux_accumulation() const
+        {
+            return m_flux_accumulation;
+        }
+
         FluxStencilCoeffs<cfg> contribution(const FluxStencilCoeffs<cfg>& flux_coeffs, double h_face, double h_cell) const
         {
             double face_measure = std::pow(h_face, dim - 1);
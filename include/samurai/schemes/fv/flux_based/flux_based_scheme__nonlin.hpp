@@ -30,7 +30,8 @@ namespace samurai
       private:
 
         FluxDefinition<cfg> m_flux_definition;
-        bool m_include_boundary_fluxes = true;
+        bool m_include_boundary_fluxes       = true;
+        FluxAccumulation m_flux_accumulation = FluxAccumulation::Atomic;
 
       public:
 
@@ -59,6 +60,16 @@ namespace samurai
             return m_include_boundary_fluxes;
         }
 
+        void set_flux_accumulation(FluxAccumulation flux_accumulation)
+        {
+            m_flux_accumulation = flux_accumulation;
+        }
+
+        FluxAccumulation flux_accumulation() const
+        {
+            return m_flux_accumulation;
+        }
+
         template <class T> // FluxValue<cfg> or StencilJacobian<cfg>
         T contribution(const T& flux_value, double h_face, double h_cell) const
         {
@@ -85,6 +96,76 @@ namespace samurai
          */
         template <Run run_type = Run::Sequential, class Func>
         void for_each_interior_interface(std::size_t d, input_field_t& field, Func&& apply_contrib) const
+        {
+            with_flux_function(d,
+                               [&](const auto& flux_function)
+                               {
+                                   for_each_interior_interface<run_type>(d, field, flux_function, apply_contrib);
+                               });
+        }
+
+        /**
+         * This function is used in the Explicit class to iterate over the boundary interfaces
+         * in a specific direction and receive the contribution computed from the stencil.
+         */
+        template <Run run_type = Run::Sequential, class Func>
+        void for_each_boundary_interface(std::size_t d, input_field_t& field, Func&& apply_contrib) const
+        {
+            with_flux_function(d,
+                               [&](const auto& flux_function)
+                               {
+                                   for_each_boundary_interface<run_type>(d, field, flux_function, apply_contrib);
+                               });
+        }
+
+        /**
+         * Calls @param f with the non-conservative flux function of the direction d.
+         * If the conservative flux has been defined at compile time (see make_flux_based_scheme<cfg>(flux)),
+         * f receives it with its type, so that it can be inlined. Otherwise, it receives the std::function.
+         */
+        template <class Func>
+        void with_flux_function(std::size_t d, Func&& f) const
+        {
+            auto& flux_def = flux_definition()[d];
+
+            if constexpr (has_static_flux_v<cfg>)
+            {
+                bool found = false;
+                static_for<0, dim>::apply(
+                    [&](auto integral_constant_d)
+                    {
+                        static constexpr std::size_t static_d = decltype(integral_constant_d)::value;
+
+                        if (static_d != d || flux_def.flux_function)
+                        {
+                            return;
+                        }
+                        if (auto* static_flux = static_flux_function<static_d>(flux_def))
+                        {
+                            found = true;
+                            f(
+                                [static_flux](auto& cells, const auto& field)
+                                {
+                                    FluxValuePair<cfg> fluxes;
+                                    fluxes[0] = (*static_flux)(cells, field);
+                                    fluxes[1] = -fluxes[0];
+                                    return fluxes;
+                                });
+                        }
+                    });
+                if (found)
+                {
+                    return;
+                }
+            }
+            f(flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative());
+        }
+
+        /**
+         * Implementation of for_each_interior_interface(d, field, apply_contrib) for the flux function given by with_flux_function().
+         */
+        template <Run run_type, class FluxFunction, class Func>
+        void for_each_interior_interface(std::size_t d, input_field_t& field, const FluxFunction& flux_function, Func&& apply_contrib) const
         {
             auto& mesh = field.mesh();
 
@@ -93,8 +174,6 @@ namespace samurai
 
             auto& flux_def = flux_definition()[d];
 
-            auto flux_function = flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative();
-
             // Same level
             for (std::size_t level = min_level; level <= max_level; ++level)
             {
@@ -159,18 +238,15 @@ namespace samurai
         }
 
         /**
-         * This function is used in the Explicit class to iterate over the boundary interfaces
-         * in a specific direction and receive the contribution computed from the stencil.
+         * Implementation of for_each_boundary_interface(d, field, apply_contrib) for the flux function given by with_flux_function().
          */
-        template <Run run_type = Run::Sequential, class Func>
-        void for_each_boundary_interface(std::size_t d, input_field_t& field, Func&& apply_contrib) const
+        template <Run run_type, class FluxFunction, class Func>
+        void for_each_boundary_interface(std::size_t d, input_field_t& field, const FluxFunction& flux_function, Func&& apply_contrib) const
         {
             auto& mesh = field.mesh();
 
             auto& flux_def = flux_definition()[d];
 
-            auto flux_function = flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative();
-
             for_each_level(mesh,
                            [&](auto level)
                            {
@@ -203,6 +279,142 @@ namespace samurai
                            });
         }
 
+        /**
+         * @returns true if the flux of the direction d is computed interval by interval by the explicit scheme
+         * (see set_cons_interval_flux_function()).
+         */
+        bool has_interval_flux(std::size_t d) const
+        {
+            auto& flux_def = flux_definition()[d];
+            return flux_def.cons_interval_flux_function() && !flux_def.flux_function;
+        }
+
+        double contribution_factor(double h_face, double h_cell) const
+        {
+            return std::pow(h_face, dim - 1) / std::pow(h_cell, dim);
+        }
+
+        /**
+         * This function is used in the Explicit class to iterate over the interior interfaces in a specific direction,
+         * interval by interval, and receive the fluxes computed by set_cons_interval_flux_function().
+         * The callback @param apply_contrib has the signature
+         *           void apply_contrib(auto& interface_it, const IntervalFluxValue<cfg>& fluxes, double left_factor, double right_factor)
+         * where the contribution of the interface ii to its left (resp. right) cell is left_factor * fluxes[ii]
+         * (resp. right_factor * fluxes[ii]).
+         */
+        template <Run run_type = Run::Sequential, class Func>
+        void for_each_interior_interface_interval(std::size_t d, input_field_t& field, Func&& apply_contrib) const
+        {
+            auto& mesh = field.mesh();
+
+            auto min_level = mesh[mesh_id_t::cells].min_level();
+            auto max_level = mesh[mesh_id_t::cells].max_level();
+
+            auto& flux_def = flux_definition()[d];
+
+            // Same level
+            for (std::size_t level = min_level; level <= max_level; ++level)
+            {
+                auto h      = cell_length(level);
+                auto factor = contribution_factor(h, h);
+
+                for_each_interior_interface__same_level<run_type, Get::Intervals>(mesh,
+                                                                                  level,
+                                                                                  flux_def.direction,
+                                                                                  flux_def.stencil,
+                                                                                  [&](auto& interface_it, auto& comput_it)
+                                                                                  {
+                                                                                      auto fluxes = interval_fluxes(d, field, comput_it);
+                                                                                      apply_contrib(interface_it, fluxes, factor, -factor);
+                                                                                  });
+            }
+
+            // Level jumps (level -- level+1)
+            for (std::size_t level = min_level; level < max_level; ++level)
+            {
+                auto h_l           = cell_length(level);
+                auto h_lp1         = cell_length(level + 1);
+                auto coarse_factor = contribution_factor(h_lp1, h_l);
+                auto fine_factor   = contribution_factor(h_lp1, h_lp1);
+
+                //         |__|   l+1
+                //    |____|      l
+                //    --------->
+                //    direction
+                for_each_interior_interface__level_jump_direction<run_type, Get::Intervals>(
+                    mesh,
+                    level,
+                    flux_def.direction,
+                    flux_def.stencil,
+                    [&](auto& interface_it, auto& comput_it)
+                    {
+                        auto fluxes = interval_fluxes(d, field, comput_it);
+                        apply_contrib(interface_it, fluxes, coarse_factor, -fine_factor);
+                    });
+
+                //    |__|        l+1
+                //       |____|   l
+                //    --------->
+                //    direction
+                for_each_interior_interface__level_jump_opposite_direction<run_type, Get::Intervals>(
+                    mesh,
+                    level,
+                    flux_def.direction,
+                    flux_def.stencil,
+                    [&](auto& interface_it, auto& comput_it)
+                    {
+                        auto fluxes = interval_fluxes(d, field, comput_it);
+                        apply_contrib(interface_it, fluxes, fine_factor, -coarse_factor);
+                    });
+            }
+        }
+
+        /**
+         * This function is used in the Explicit class to iterate over the boundary interfaces in a specific direction,
+         * interval by interval, and receive the fluxes computed by set_cons_interval_flux_function().
+         * The callback @param apply_contrib has the signature
+         *           void apply_contrib(auto& first_cell, const IntervalFluxValue<cfg>& fluxes, double factor)
+         * where the contribution to the cell ii of the interval is factor * fluxes[ii].
+         */
+        template <Run run_type = Run::Sequential, class Func>
+        void for_each_boundary_interface_interval(std::size_t d, input_field_t& field, Func&& apply_contrib) const
+        {
+            auto& mesh = field.mesh();
+
+            auto& flux_def = flux_definition()[d];
+
+            for_each_level(mesh,
+                           [&](auto level)
+                           {
+                               auto h      = cell_length(level);
+                               auto factor = contribution_factor(h, h);
+
+                               // Boundary in direction
+                               for_each_boundary_interface__direction<run_type, Get::Intervals>(
+                                   mesh,
+                                   level,
+                                   flux_def.direction,
+                                   flux_def.stencil,
+                                   [&](auto& cell, auto& comput_it)
+                                   {
+                                       auto fluxes = interval_fluxes(d, field, comput_it);
+                                       apply_contrib(cell, fluxes, factor);
+                                   });
+
+                               // Boundary in opposite direction
+                               for_each_boundary_interface__opposite_direction<run_type, Get::Intervals>(
+                                   mesh,
+                                   level,
+                                   flux_def.direction,
+                                   flux_def.stencil,
+                                   [&](auto& cell, auto& comput_it)
+                                   {
+                                       auto fluxes = interval_fluxes(d, field, comput_it);
+                                       apply_contrib(cell, fluxes, -factor);
+                                   });
+                           });
+        }
+
         /**
          * This function is used in the Assembly class to iterate over the interior interfaces
          * and receive the Jacobian coefficients.
@@ -341,6 +553,28 @@ namespace samurai
                     });
             }
         }
+
+      private:
+
+        template <class StencilIterator, std::size_t... Is>
+        IntervalFluxValue<cfg>
+        interval_fluxes(std::size_t d, const input_field_t& field, const StencilIterator& comput_it, std::index_sequence<Is...>) const
+        {
+            auto n_cells                      = comput_it.interval().size();
+            const auto& cells                 = comput_it.cells();
+            StencilIntervalValues<cfg> values = {field_interval_view(field, static_cast<std::size_t>(cells[Is].index), n_cells)...};
+            return flux_definition()[d].cons_interval_flux_function()(values);
+        }
+
+        /**
+         * @returns the fluxes of the interval of interfaces of the stencil iterator,
+         * computed from the views on the field values of each cell of the stencil.
+         */
+        template <class StencilIterator>
+        IntervalFluxValue<cfg> interval_fluxes(std::size_t d, const input_field_t& field, const StencilIterator& comput_it) const
+        {
+            return interval_fluxes(d, field, comput_it, std::make_index_sequence<cfg::stencil_size>{});
+        }
     };
 
 } // end namespace samurai
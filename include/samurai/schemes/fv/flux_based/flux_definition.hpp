@@ -1,6 +1,9 @@
 #pragma once
 #include "../utils.hpp"
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <xtensor/xtensor.hpp>
 
 namespace samurai
 {
@@ -14,6 +17,32 @@ namespace samurai
         static constexpr std::size_t dim               = input_field_t::dim;
     };
 
+    /**
+     * Config of a NON-LINEAR scheme whose conservative flux is the callable type Flux, known at compile time
+     * (see make_flux_based_scheme<cfg>(flux)). For the direction d, the flux is called as
+     *           flux(std::integral_constant<std::size_t, d>{}, cells, field).
+     */
+    template <class cfg, class Flux>
+    struct StaticFluxConfig : cfg
+    {
+        static_assert(cfg::scheme_type == SchemeType::NonLinear, "Only the non-linear fluxes can be defined at compile time.");
+
+        using flux_t = Flux;
+    };
+
+    template <class cfg, class = void>
+    struct has_static_flux : std::false_type
+    {
+    };
+
+    template <class cfg>
+    struct has_static_flux<cfg, std::void_t<typename cfg::flux_t>> : std::true_type
+    {
+    };
+
+    template <class cfg>
+    inline constexpr bool has_static_flux_v = has_static_flux<cfg>::value;
+
     template <class cfg>
     struct NormalFluxDefinitionBase
     {
@@ -65,6 +94,63 @@ namespace samurai
     template <class cfg>
     using StencilJacobianPair = Array<StencilJacobian<cfg>, 2>;
 
+    /**
+     * Values of the field for an interval of interfaces:
+     * 'values[c]' is the view on the field values of the interval of cells shifted by 'stencil[c]'
+     * (see field_interval_view() for its shape).
+     */
+    template <class cfg>
+    using StencilIntervalValues = std::array<decltype(field_interval_view(std::declval<const typename cfg::input_field_t&>(), 0, 0)),
+                                             cfg::stencil_size>;
+
+    /**
+     * Fluxes of an interval of interfaces.
+     * Shape: (n_interfaces) if output_field_size = 1, (n_interfaces, output_field_size) otherwise.
+     */
+    template <class cfg>
+    using IntervalFluxValue = xt::xtensor<typename cfg::input_field_t::value_type, (cfg::output_field_size == 1 ? 1 : 2)>;
+
+    /**
+     * std::function of a conservative non-linear flux, which can also carry the same flux computed on whole intervals
+     * (see NormalFluxDefinition::set_cons_interval_flux_function()).
+     * Assigning another function drops the interval version, so that it never takes priority over a flux set afterwards.
+     */
+    template <class Function, class IntervalFunction>
+    class ConsFluxFunction : public Function
+    {
+      public:
+
+        ConsFluxFunction() = default;
+
+        template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, ConsFluxFunction>>>
+        ConsFluxFunction(F&& f)
+            : Function(std::forward<F>(f))
+        {
+        }
+
+        template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, ConsFluxFunction>>>
+        ConsFluxFunction& operator=(F&& f)
+        {
+            Function::operator=(std::forward<F>(f));
+            m_interval_function = nullptr;
+            return *this;
+        }
+
+        const IntervalFunction& interval_function() const
+        {
+            return m_interval_function;
+        }
+
+        void set_interval_function(IntervalFunction interval_function)
+        {
+            m_interval_function = std::move(interval_function);
+        }
+
+      private:
+
+        IntervalFunction m_interval_function = nullptr;
+    };
+
     /**
      * Specialization of @class NormalFluxDefinition.
      * Defines how to compute a NON-LINEAR normal flux.
@@ -82,11 +168,14 @@ namespace samurai
         using jacobian_func      = std::function<StencilJacobianPair<cfg>(stencil_cells_t&, const field_t&)>; // non-conservative
         using cons_jacobian_func = std::function<StencilJacobian<cfg>(stencil_cells_t&, const field_t&)>;     // conservative
 
+        using cons_interval_flux_func = std::function<IntervalFluxValue<cfg>(const StencilIntervalValues<cfg>&)>; // conservative
+
         /**
          * Conservative flux function:
          * @returns the flux in the positive direction.
+         * Assigning it drops its interval version (see set_cons_interval_flux_function()).
          */
-        cons_flux_func cons_flux_function = nullptr;
+        ConsFluxFunction<cons_flux_func, cons_interval_flux_func> cons_flux_function = nullptr;
 
         /**
          * Non-conservative flux function:
@@ -98,6 +187,30 @@ namespace samurai
         cons_jacobian_func cons_jacobian_function = nullptr;
         jacobian_func jacobian_function           = nullptr;
 
+        /**
+         * Sets the same flux as 'cons_flux_function', computed on a whole interval of interfaces (optional):
+         * @param interval_flux returns the fluxes in the positive direction, computed from the views on the stencil values
+         * (one per stencil cell). E.g., for the upwind scalar Burgers flux with the stencil {{0,0}, {1,0}}:
+         *
+         *            [](const auto& u) -> IntervalFluxValue<cfg>
+         *            {
+         *                return xt::where(u[0] >= 0, u[0] * u[0], u[1] * u[1]);
+         *            };
+         *
+         * If set, the explicit scheme calls it once per interval instead of calling 'cons_flux_function' once per interface,
+         * which lets the flux computation be vectorized. It is ignored if 'flux_function' is set,
+         * and dropped when another function is assigned to 'cons_flux_function'.
+         */
+        void set_cons_interval_flux_function(cons_interval_flux_func interval_flux)
+        {
+            cons_flux_function.set_interval_function(std::move(interval_flux));
+        }
+
+        const cons_interval_flux_func& cons_interval_flux_function() const
+        {
+            return cons_flux_function.interval_function();
+        }
+
         /**
          * @returns the non-conservative flux function that calls the conservative one.
          * This function is used to default 'flux_function' if it is not set.
@@ -143,6 +256,42 @@ namespace samurai
         }
     };
 
+    /**
+     * Conservative flux function of the direction d built from the compile-time flux of a StaticFluxConfig.
+     * It is stored in the std::function 'cons_flux_function', from which the scheme gets it back with its type
+     * (see static_flux_function()) to call it without type erasure.
+     */
+    template <class cfg, std::size_t d>
+    struct DirectionalFlux
+    {
+        typename cfg::flux_t flux;
+        double scale = 1; // set by the multiplication by a scalar, which then keeps the type of the function
+
+        template <class Cells, class Field>
+        FluxValue<cfg> operator()(Cells& cells, const Field& field) const
+        {
+            FluxValue<cfg> value = flux(std::integral_constant<std::size_t, d>{}, cells, field);
+            return scale * value;
+        }
+    };
+
+    /**
+     * @returns the compile-time flux of the direction d, or nullptr if 'cons_flux_function' has been replaced
+     * by another function (or if the config has no compile-time flux).
+     */
+    template <std::size_t d, class cfg>
+    const DirectionalFlux<cfg, d>* static_flux_function([[maybe_unused]] const NormalFluxDefinition<cfg>& flux_definition)
+    {
+        if constexpr (has_static_flux_v<cfg>)
+        {
+            return flux_definition.cons_flux_function.template target<DirectionalFlux<cfg, d>>();
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
     template <class cfg>
     using FluxStencilCoeffs = StencilJacobian<cfg>;
 
@@ -136,45 +136,68 @@ namespace samurai
         }
         else
         {*/
-        FluxDefinition<cfg> upwind;
+        // The flux is given with its type (and not as std::function), so that it can be inlined in the loops over the interfaces
+        auto upwind = [](auto integral_constant_d, auto& cells, const Field& field) -> FluxValue<cfg>
+        {
+            static constexpr std::size_t d = decltype(integral_constant_d)::value;
 
-        static_for<0, dim>::apply( // for each positive Cartesian direction 'd'
-            [&](auto integral_constant_d)
+            auto f = [](auto u) -> FluxValue<cfg>
             {
-                static constexpr std::size_t d = decltype(integral_constant_d)::value;
-
-                auto f = [](auto u) -> FluxValue<cfg>
+                if constexpr (field_size == 1)
                 {
-                    if constexpr (field_size == 1)
-                    {
-                        return u * u;
-                    }
-                    else
-                    {
-                        return u(d) * u;
-                    }
-                };
-
-                upwind[d].cons_flux_function = [f](auto& cells, const Field& field)
+                    return u * u;
+                }
+                else
                 {
-                    auto& left  = cells[0];
-                    auto& right = cells[1];
+                    return u(d) * u;
+                }
+            };
 
-                    field_value_t v;
-                    if constexpr (field_size == 1)
-                    {
-                        v = field[left];
-                    }
-                    else
-                    {
-                        v = field[left](d);
-                    }
+            auto& left  = cells[0];
+            auto& right = cells[1];
+
+            field_value_t v;
+            if constexpr (field_size == 1)
+            {
+                v = field[left];
+            }
+            else
+            {
+                v = field[left](d);
+            }
+
+            return v >= 0 ? f(field[left]) : f(field[right]);
+        };
+
+        auto scheme = make_flux_based_scheme<cfg>(upwind);
+
+        // Same flux, computed for a whole interval of interfaces: used by the explicit scheme
+        static_for<0, dim>::apply(
+            [&](auto integral_constant_d)
+            {
+                static constexpr std::size_t d = decltype(integral_constant_d)::value;
 
-                    return v >= 0 ? f(field[left]) : f(field[right]);
-                };
+                scheme.flux_definition()[d].set_cons_interval_flux_function(
+                    [](const auto& u) -> IntervalFluxValue<cfg>
+                    {
+                        auto& left  = u[0];
+                        auto& right = u[1];
+
+                        if constexpr (field_size == 1)
+                        {
+                            return xt::where(left >= 0, left * left, right * right);
+                        }
+                        else
+                        {
+                            // velocity component in the direction d, shape (n, 1) to be broadcast on the field components
+                            auto v_left  = xt::view(left, xt::all(), xt::range(d, d + 1));
+                            auto v_right = xt::view(right, xt::all(), xt::range(d, d + 1));
+                            return xt::where(v_left >= 0, v_left * left, v_right * right);
+                        }
+                    });
             });
 
-        return make_flux_based_scheme(upwind);
+        return scheme;
     }
 
     template <class Field>
@@ -194,55 +217,47 @@ namespace samurai
 
         using cfg = FluxConfig<SchemeType::NonLinear, output_field_size, stencil_size, Field>;
 
-        FluxDefinition<cfg> weno5;
+        // Default stencil in the direction d: {-2, -1, 0, 1, 2, 3}
+        auto weno5 = [](auto integral_constant_d, auto& cells, const Field& u) -> FluxValue<cfg>
+        {
+            static constexpr std::size_t d              = decltype(integral_constant_d)::value;
+            static constexpr std::size_t stencil_center = 2;
 
-        static_for<0, dim>::apply( // for each positive Cartesian direction 'd'
-            [&](auto integral_constant_d)
+            auto f = [](auto v) -> FluxValue<cfg>
             {
-                static constexpr std::size_t d = decltype(integral_constant_d)::value;
-
-                auto f = [](auto u) -> FluxValue<cfg>
+                if constexpr (field_size == 1)
                 {
-                    if constexpr (field_size == 1)
-                    {
-                        return u * u;
-                    }
-                    else
-                    {
-                        return u(d) * u;
-                    }
-                };
-
-                weno5[d].stencil = line_stencil<dim, d>(-2, -1, 0, 1, 2, 3);
-
-                weno5[d].cons_flux_function = [f](auto& cells, const Field& u) -> FluxValue<cfg>
+                    return v * v;
+                }
+                else
                 {
-                    static constexpr std::size_t stencil_center = 2;
+                    return v(d) * v;
+                }
+            };
 
-                    field_value_t v;
-                    if constexpr (field_size == 1)
-                    {
-                        v = u[cells[stencil_center]];
-                    }
-                    else
-                    {
-                        v = u[cells[stencil_center]](d);
-                    }
+            field_value_t v;
+            if constexpr (field_size == 1)
+            {
+                v = u[cells[stencil_center]];
+            }
+            else
+            {
+                v = u[cells[stencil_center]](d);
+            }
 
-                    if (v >= 0)
-                    {
-                        std::array<FluxValue<cfg>, 5> f_u = {f(u[cells[0]]), f(u[cells[1]]), f(u[cells[2]]), f(u[cells[3]]), f(u[cells[4]])};
-                        return compute_weno5_flux(f_u);
-                    }
-                    else
-                    {
-                        std::array<FluxValue<cfg>, 5> f_u = {f(u[cells[5]]), f(u[cells[4]]), f(u[cells[3]]), f(u[cells[2]]), f(u[cells[1]])};
-                        return compute_weno5_flux(f_u);
-                    }
-                };
-            });
+            if (v >= 0)
+            {
+                std::array<FluxValue<cfg>, 5> f_u = {f(u[cells[0]]), f(u[cells[1]]), f(u[cells[2]]), f(u[cells[3]]), f(u[cells[4]])};
+                return compute_weno5_flux(f_u);
+            }
+            else
+            {
+                std::array<FluxValue<cfg>, 5> f_u = {f(u[cells[5]]), f(u[cells[4]]), f(u[cells[3]]), f(u[cells[2]]), f(u[cells[1]])};
+                return compute_weno5_flux(f_u);
+            }
+        };
 
-        return make_flux_based_scheme(weno5);
+        return make_flux_based_scheme<cfg>(weno5);
     }
 
 } // end namespace samurai
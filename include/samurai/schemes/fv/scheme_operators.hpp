@@ -59,6 +59,7 @@ namespace samurai
       private:
 
         std::tuple<Operators...> m_operators;
+        bool m_fused_evaluation = false;
 
       public:
 
@@ -88,6 +89,20 @@ namespace samurai
             return m_operators;
         }
 
+        /**
+         * If true, the explicit evaluation browses the interfaces only once for all the flux-based operators of the sum,
+         * instead of once per operator (see @class Explicit<OperatorSum>).
+         */
+        void fused_evaluation(bool fused)
+        {
+            m_fused_evaluation = fused;
+        }
+
+        bool fused_evaluation() const
+        {
+            return m_fused_evaluation;
+        }
+
         std::string name() const
         {
             std::stringstream ss;
@@ -120,6 +135,15 @@ namespace samurai
             auto explicit_scheme = make_explicit(*this);
             explicit_scheme.apply(output_field, input_field);
         }
+
+        /**
+         * output_field = alpha * input_field + beta * (sum of the operators)(input_field), computed without temporary field
+         */
+        void apply_axpy(output_field_t& output_field, double alpha, input_field_t& input_field, double beta) const
+        {
+            auto explicit_scheme = make_explicit(*this);
+            explicit_scheme.apply_axpy(output_field, alpha, input_field, beta);
+        }
     };
 
     template <class... Operators>
@@ -211,8 +235,10 @@ namespace samurai
         -> std::enable_if_t<!scheme_is_combinable<CellBasedScheme<cfg, bdry_cfg>, Operators...>,
                             OperatorSum<Operators..., CellBasedScheme<cfg, bdry_cfg>>>
     {
-        auto added = std::tuple_cat(sum_scheme.operators(), std::make_tuple(scheme));
-        return make_operator_sum(added);
+        auto added          = std::tuple_cat(sum_scheme.operators(), std::make_tuple(scheme));
+        auto new_sum_scheme = make_operator_sum(added);
+        new_sum_scheme.fused_evaluation(sum_scheme.fused_evaluation());
+        return new_sum_scheme;
     }
 
     // uncombinable CellBasedScheme + OperatorSum
@@ -221,8 +247,10 @@ namespace samurai
         -> std::enable_if_t<!scheme_is_combinable<CellBasedScheme<cfg, bdry_cfg>, Operators...>,
                             OperatorSum<CellBasedScheme<cfg, bdry_cfg>, Operators...>>
     {
-        auto added = std::tuple_cat(std::make_tuple(scheme), sum_scheme.operators());
-        return make_operator_sum(added);
+        auto added          = std::tuple_cat(std::make_tuple(scheme), sum_scheme.operators());
+        auto new_sum_scheme = make_operator_sum(added);
+        new_sum_scheme.fused_evaluation(sum_scheme.fused_evaluation());
+        return new_sum_scheme;
     }
 
     /**
@@ -1,6 +1,8 @@
 #pragma once
 #include "algebraic_array.hpp"
 #include <xtensor/xfixed.hpp>
+#include <xtensor/xmanipulation.hpp>
+#include <xtensor/xview.hpp>
 
 namespace samurai
 {
@@ -185,6 +187,29 @@ namespace samurai
     template <class cfg>
     using StencilCells = CollapsStdArray<typename cfg::input_field_t::cell_t, cfg::stencil_size>;
 
+    /**
+     * View on the values of the field @param f in the @param n_cells cells stored contiguously from @param first_cell_index
+     * (e.g. the cells of an interval).
+     * Shape: (n_cells) if the field is scalar, (n_cells, Field::size) otherwise.
+     */
+    template <class Field>
+    auto field_interval_view(Field& f, std::size_t first_cell_index, std::size_t n_cells)
+    {
+        auto cells = xt::range(first_cell_index, first_cell_index + n_cells);
+        if constexpr (Field::size == 1)
+        {
+            return xt::view(f.array(), cells);
+        }
+        else if constexpr (Field::is_soa)
+        {
+            return xt::transpose(xt::view(f.array(), xt::all(), cells));
+        }
+        else
+        {
+            return xt::view(f.array(), cells, xt::all());
+        }
+    }
+
     template <class cfg>
     using JacobianMatrix = CollapsMatrix<typename cfg::input_field_t::value_type, cfg::output_field_size, cfg::input_field_t::size>;
 
@@ -0,0 +1,158 @@
+// Copyright 2018-2024 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <xtensor/xfixed.hpp>
+
+#include "box.hpp"
+
+namespace samurai
+{
+    /**
+     * Position of the cell of coordinates @param indices along the Morton (Z-order) curve:
+     * the bits of the coordinates are interleaved, the first direction giving the lowest bit.
+     * The coordinates must be non-negative and lower than 2^(64/dim).
+     */
+    template <std::size_t dim, class Indices>
+    inline std::uint64_t morton_key(const Indices& indices)
+    {
+        constexpr std::size_t nb_bits = 64 / dim;
+
+        std::uint64_t key = 0;
+        for (std::size_t b = 0; b < nb_bits; ++b)
+        {
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                key |= ((static_cast<std::uint64_t>(indices[d]) >> b) & 1) << (b * dim + d);
+            }
+        }
+        return key;
+    }
+
+    namespace detail
+    {
+        /// Adds the cells of the box [lo, hi[ to the level cell list.
+        template <class LevelCellList, class Point>
+        void add_box_to_lcl(LevelCellList& lcl, const Point& lo, const Point& hi)
+        {
+            static constexpr std::size_t dim = LevelCellList::dim;
+            using value_t                    = typename Point::value_type;
+
+            xt::xtensor_fixed<value_t, xt::xshape<dim - 1>> index;
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                index[d] = lo[d + 1];
+            }
+            while (true)
+            {
+                lcl[index].add_interval({lo[0], hi[0]});
+
+                std::size_t d = 0;
+                for (; d < dim - 1; ++d)
+                {
+                    if (++index[d] < hi[d + 1])
+                    {
+                        break;
+                    }
+                    index[d] = lo[d + 1];
+                }
+                if (d == dim - 1)
+                {
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Browses the cells of @param box contained in the node of the Morton curve of minimum corner @param node_min
+         * and of size @param side, and adds to @param lcl those whose position along the curve is in [begin, end[.
+         * @param offset is the position of the first cell of the node, it is incremented by the number of cells of the node.
+         */
+        template <class LevelCellList, class TValue, std::size_t dim>
+        void morton_partition_node(const Box<TValue, dim>& box,
+                                   const typename Box<TValue, dim>::point_t& node_min,
+                                   TValue side,
+                                   std::size_t begin,
+                                   std::size_t end,
+                                   std::size_t& offset,
+                                   LevelCellList& lcl)
+        {
+            using point_t = typename Box<TValue, dim>::point_t;
+
+            point_t lo;
+            point_t hi;
+            std::size_t count = 1;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                lo[d] = std::max(box.min_corner()[d], node_min[d]);
+                hi[d] = std::min(box.max_corner()[d], node_min[d] + side);
+                count *= (hi[d] > lo[d]) ? static_cast<std::size_t>(hi[d] - lo[d]) : 0;
+            }
+
+            if (count == 0)
+            {
+                return;
+            }
+            if (offset + count <= begin || offset >= end)
+            {
+                offset += count;
+                return;
+            }
+            if (begin <= offset && offset + count <= end)
+            {
+                add_box_to_lcl(lcl, lo, hi);
+                offset += count;
+                return;
+            }
+
+            // the node is shared by several parts: its children are browsed in the order of the curve
+            TValue half = side / 2;
+            for (std::size_t child = 0; child < (std::size_t(1) << dim); ++child)
+            {
+                point_t child_min = node_min;
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    child_min[d] += ((child >> d) & 1) ? half : 0;
+                }
+                morton_partition_node(box, child_min, half, begin, end, offset, lcl);
+            }
+        }
+    }
+
+    /**
+     * Adds to @param lcl the cells of @param box (given at the level of @param lcl) belonging to the part @param part
+     * when the cells of the box, ordered along the Morton curve, are split into @param nb_parts parts of the same size
+     * (the first parts get one more cell if the number of cells is not divisible by nb_parts).
+     *
+     * The curve is browsed recursively by quadrants/octants: those entirely contained in the part are added as boxes,
+     * so that only the quadrants crossing the boundaries of the part are refined.
+     */
+    template <class LevelCellList, class TValue, std::size_t dim>
+    void morton_partition(const Box<TValue, dim>& box, std::size_t nb_parts, std::size_t part, LevelCellList& lcl)
+    {
+        std::size_t nb_cells = 1;
+        TValue side          = 1;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            auto length = box.max_corner()[d] - box.min_corner()[d];
+            nb_cells *= static_cast<std::size_t>(std::max(length, TValue(0)));
+            while (side < length)
+            {
+                side *= 2;
+            }
+        }
+
+        auto part_start = [&](std::size_t p)
+        {
+            return nb_cells / nb_parts * p + std::min(p, nb_cells % nb_parts);
+        };
+
+        std::size_t offset = 0;
+        detail::morton_partition_node(box, box.min_corner(), side, part_start(part), part_start(part + 1), offset, lcl);
+    }
+}
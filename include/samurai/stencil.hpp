@@ -540,6 +540,24 @@ namespace samurai
             }
         }
 
+        /**
+         * Same as init(mesh_interval), but the cells are given by @param first_cells,
+         * the cells previously computed by init() at the start of an interval containing @param mesh_interval.
+         * No search is performed in the mesh.
+         */
+        void init(const mesh_interval_t& mesh_interval, const std::array<cell_t, stencil_size>& first_cells)
+        {
+            m_mesh_interval = &mesh_interval;
+            m_cells         = first_cells;
+
+            auto shift = mesh_interval.i.start - m_cells[m_origin_cell].indices[0];
+            for (cell_t& cell : m_cells)
+            {
+                cell.index += shift;
+                cell.indices[0] += shift;
+            }
+        }
+
         inline const auto& mesh() const
         {
             return m_mesh;
@@ -612,6 +630,24 @@ namespace samurai
             m_ii = 0;
         }
 
+        /**
+         * Same as init(fine_mesh_interval), but the cells are given by @param first_cells,
+         * the cells previously computed by init() at the start of a fine interval containing the current one
+         * (the fine iterator must already be initialized, and the shift along x must be even).
+         */
+        void init(const mesh_interval_t&, const std::array<cell_t, 2>& first_cells)
+        {
+            m_cells = first_cells;
+
+            auto shift = m_fine_it->cells()[m_direction_index].indices[0] - m_cells[fine].indices[0];
+            m_cells[fine].index += shift;
+            m_cells[fine].indices[0] += shift;
+            m_cells[coarse].index += shift / 2;
+            m_cells[coarse].indices[0] += shift / 2;
+
+            m_ii = 0;
+        }
+
         inline auto& interval() const
         {
             return m_fine_it->interval();
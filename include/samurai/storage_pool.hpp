@@ -0,0 +1,210 @@
+// Copyright 2018-2024 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "samurai_config.hpp"
+
+namespace samurai
+{
+    ////////////////////////////
+    // StoragePool definition //
+    ////////////////////////////
+
+    /** @class StoragePool
+     *  @brief Recycles the data containers of the fields.
+     *
+     * The containers given back by release() are kept and handed out again by
+     * acquire() when the same shape is requested. Since the shape of a field
+     * only depends on the number of cells of its mesh, the temporary fields
+     * created at each time step (outputs of the schemes, RK stages, fields of
+     * the mesh adaptation) reuse the same memory as long as the mesh does not
+     * change, without any system allocation.
+     *
+     * At most storage_pool_max_buffers containers, of storage_pool_max_bytes
+     * in total, are kept: the oldest ones are freed first, which also evicts
+     * the shapes of the previous meshes. A container larger than
+     * storage_pool_max_bytes is freed instead of being kept.
+     *
+     * @tparam Container The container type (xt::xtensor).
+     */
+    template <class Container>
+    class StoragePool
+    {
+      public:
+
+        using container_type = Container;
+        using shape_type     = typename container_type::shape_type;
+
+        StoragePool();
+
+        container_type acquire(const shape_type& shape);
+        void release(container_type&& container) noexcept;
+        void clear();
+
+        std::size_t nb_buffers() const;
+        std::size_t nb_bytes() const;
+        std::size_t nb_allocations() const;
+
+      private:
+
+        static std::size_t bytes(const container_type& container);
+
+        mutable std::mutex m_mutex;
+        std::vector<container_type> m_buffers;
+        std::size_t m_nb_bytes       = 0;
+        std::size_t m_nb_allocations = 0;
+    };
+
+    template <class Container>
+    StoragePool<Container>& storage_pool();
+
+    template <class Container>
+    void resize_from_pool(Container& container, const typename Container::shape_type& shape);
+
+    template <class Container>
+    void release_to_pool(Container& container) noexcept;
+
+    ////////////////////////////////
+    // StoragePool implementation //
+    ////////////////////////////////
+
+    template <class Container>
+    inline StoragePool<Container>::StoragePool()
+    {
+        // release() never reallocates (it is called by the destructor of the fields)
+        m_buffers.reserve(storage_pool_max_buffers);
+    }
+
+    /// Returns a container of the given shape, reused if possible. Its values are not initialized.
+    template <class Container>
+    inline auto StoragePool<Container>::acquire(const shape_type& shape) -> container_type
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // most recently released first
+            auto it = std::find_if(m_buffers.rbegin(),
+                                   m_buffers.rend(),
+                                   [&](const auto& buffer)
+                                   {
+                                       return std::equal(buffer.shape().cbegin(), buffer.shape().cend(), shape.cbegin());
+                                   });
+            if (it != m_buffers.rend())
+            {
+                container_type container = std::move(*it);
+                m_buffers.erase(std::next(it).base());
+                m_nb_bytes -= bytes(container);
+                return container;
+            }
+            ++m_nb_allocations;
+        }
+        return container_type(shape);
+    }
+
+    template <class Container>
+    inline void StoragePool<Container>::release(container_type&& container) noexcept
+    {
+        std::size_t container_bytes = bytes(container);
+        if (container.size() == 0 || storage_pool_max_buffers == 0 || container_bytes > storage_pool_max_bytes)
+        {
+            return;
+        }
+
+        // called from the destructor and the move assignment of the fields: if the pool can't keep the
+        // container (the mutex can't be locked or the list of buffers can't grow), it is just freed by its owner
+        try
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (m_buffers.size() == storage_pool_max_buffers || m_nb_bytes + container_bytes > storage_pool_max_bytes)
+            {
+                m_nb_bytes -= bytes(m_buffers.front());
+                m_buffers.erase(m_buffers.begin());
+            }
+            m_buffers.push_back(std::move(container));
+            m_nb_bytes += container_bytes;
+        }
+        catch (...)
+        {
+        }
+    }
+
+    /// Frees all the containers kept by the pool.
+    template <class Container>
+    inline void StoragePool<Container>::clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffers.clear();
+        m_nb_bytes = 0;
+    }
+
+    template <class Container>
+    inline std::size_t StoragePool<Container>::nb_buffers() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_buffers.size();
+    }
+
+    /// Total size in bytes of the containers kept by the pool.
+    template <class Container>
+    inline std::size_t StoragePool<Container>::nb_bytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_nb_bytes;
+    }
+
+    /// Number of containers that could not be reused and have been allocated.
+    template <class Container>
+    inline std::size_t StoragePool<Container>::nb_allocations() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_nb_allocations;
+    }
+
+    template <class Container>
+    inline std::size_t StoragePool<Container>::bytes(const container_type& container)
+    {
+        return container.size() * sizeof(typename container_type::value_type);
+    }
+
+    /**
+     * Pool shared by all the containers of type Container.
+     * It is never destroyed, so that the fields with static storage duration can release their
+     * container to it in their destructor, whatever the order of destruction of the static objects.
+     */
+    template <class Container>
+    inline StoragePool<Container>& storage_pool()
+    {
+        static auto* pool = new StoragePool<Container>();
+        return *pool;
+    }
+
+    /// Gives the current memory of the container back to the pool and takes a container of the new shape from it.
+    template <class Container>
+    inline void resize_from_pool(Container& container, const typename Container::shape_type& shape)
+    {
+        std::size_t size = std::accumulate(shape.cbegin(), shape.cend(), std::size_t{1}, std::multiplies<>());
+        if (container.size() == size && std::equal(container.shape().cbegin(), container.shape().cend(), shape.cbegin()))
+        {
+            return;
+        }
+        auto& pool    = storage_pool<Container>();
+        auto previous = std::move(container);
+        container     = pool.acquire(shape);
+        pool.release(std::move(previous));
+    }
+
+    template <class Container>
+    inline void release_to_pool(Container& container) noexcept
+    {
+        storage_pool<Container>().release(std::move(container));
+    }
+}
@@ -4,7 +4,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <type_traits>
 
@@ -286,6 +290,31 @@ namespace samurai
         return static_cast<R>(static_cast<std::ptrdiff_t>(a) - static_cast<std::ptrdiff_t>(b));
     }
 
+    /**
+     * Storage index of an interval whose first cell is stored at position
+     * acc_size.
+     *
+     * If the index type is smaller than std::ptrdiff_t (e.g. with
+     * default_config::compact_interval_t), an std::overflow_error is thrown
+     * when the index of a cell of the interval doesn't fit in this type.
+     */
+    template <class R, class TInterval>
+    R storage_index(std::size_t acc_size, const TInterval& interval)
+    {
+        const auto index = safe_subs<std::ptrdiff_t>(acc_size, interval.start);
+        if constexpr (sizeof(R) < sizeof(std::ptrdiff_t))
+        {
+            const auto last_cell = static_cast<std::ptrdiff_t>(acc_size + interval.size()) - 1;
+            if (index < std::numeric_limits<R>::min() || index > std::numeric_limits<R>::max()
+                || last_cell > std::numeric_limits<R>::max())
+            {
+                throw std::overflow_error("The storage index of the cell " + std::to_string(last_cell)
+                                          + " doesn't fit in the index type of the intervals");
+            }
+        }
+        return static_cast<R>(index);
+    }
+
     template <class Field>
     inline auto& field_value(Field& f, const typename Field::cell_t& cell, [[maybe_unused]] std::size_t field_i)
     {
@@ -33,4 +33,131 @@ namespace samurai
         adapt(1e-4, 2);
         ::samurai::finalize();
     }
+
+    TYPED_TEST(adapt_test, incremental_update)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<config>;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+        using ca_type                    = typename mesh_t::ca_type;
+        using cl_type                    = typename mesh_t::cl_type;
+
+        auto mesh = mesh_t({xt::zeros<double>({dim}), xt::ones<double>({dim})}, 2, 4);
+
+        for (int step = 0; step < 3; ++step)
+        {
+            auto tag = make_field<int, 1>("tag", mesh);
+            for_each_cell(mesh[mesh_id_t::cells],
+                          [&](const auto& cell)
+                          {
+                              auto flag = CellFlag::keep;
+                              if (cell.index % 9 == step)
+                              {
+                                  flag = CellFlag::coarsen;
+                              }
+                              else if (cell.index % 11 == step)
+                              {
+                                  flag = CellFlag::refine;
+                              }
+                              tag[cell] = static_cast<int>(flag);
+                          });
+
+            ca_type cells;
+            ASSERT_TRUE(detail::adapted_cell_array(tag, mesh, cells));
+            cells.update_index();
+
+            cl_type cl;
+            detail::adapted_cell_list(tag, mesh, cl);
+            EXPECT_EQ(cells, ca_type(cl));
+
+            mesh_t new_mesh = detail::adapted_mesh(tag, mesh);
+            EXPECT_EQ(new_mesh, mesh_t(cl, mesh));
+            mesh = new_mesh;
+        }
+    }
+
+    TYPED_TEST(adapt_test, unchanged_mesh)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<config>;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+
+        auto mesh = mesh_t({xt::zeros<double>({dim}), xt::ones<double>({dim})}, 2, 4);
+        auto u    = make_field<double, 1>("u", mesh, 1.);
+        auto tag  = make_field<int, 1>("tag", mesh, static_cast<int>(CellFlag::keep));
+
+        // the cells are at the maximum level: refining them doesn't change the mesh
+        auto cells = mesh[mesh_id_t::cells];
+        tag.fill(static_cast<int>(CellFlag::refine));
+        EXPECT_TRUE(update_field(tag, u));
+        EXPECT_TRUE(mesh[mesh_id_t::cells] == cells);
+
+        tag.fill(static_cast<int>(CellFlag::coarsen));
+        EXPECT_FALSE(update_field(tag, u));
+        EXPECT_FALSE(mesh[mesh_id_t::cells] == cells);
+    }
+
+    TYPED_TEST(adapt_test, ghost_update_plan)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<config>;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+        constexpr std::size_t pred_order = config::prediction_order;
+
+        auto mesh = mesh_t({xt::zeros<double>({dim}), xt::ones<double>({dim})}, 2, 4);
+        auto u    = make_field<double, 1>("u", mesh);
+
+        // two levels of coarsening on the left part of the domain
+        for (int step = 0; step < 2; ++step)
+        {
+            auto tag = make_field<int, 1>("tag", mesh);
+            for_each_cell(mesh[mesh_id_t::cells],
+                          [&](const auto& cell)
+                          {
+                              tag[cell] = static_cast<int>(cell.center(0) < 0.5 ? CellFlag::coarsen : CellFlag::keep);
+                          });
+            update_field(tag, u);
+        }
+        EXPECT_LT(mesh[mesh_id_t::cells].min_level(), mesh[mesh_id_t::cells].max_level());
+
+        u.fill(0);
+        for_each_cell(mesh[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          u[cell] = cell.center(0) * cell.center(0);
+                      });
+        auto expected = u;
+
+        // the plan is built once for the mesh, then replayed by update_ghost_mr()
+        auto plan = detail::ghost_update_plan(mesh);
+        EXPECT_EQ(detail::ghost_update_plan(mesh), plan);
+        update_ghost_mr(u);
+
+        // same subsets as the plan, evaluated directly
+        std::size_t min_level = mesh[mesh_id_t::reference].min_level();
+        std::size_t max_level = mesh[mesh_id_t::reference].max_level();
+        for (std::size_t level = max_level; level > min_level; --level)
+        {
+            auto set_at_levelm1 = intersection(mesh[mesh_id_t::reference][level], mesh[mesh_id_t::proj_cells][level - 1]).on(level - 1);
+            set_at_levelm1.apply_op(variadic_projection(expected));
+        }
+        for (std::size_t level = min_level + 1; level <= max_level; ++level)
+        {
+            auto expr = intersection(difference(mesh[mesh_id_t::all_cells][level],
+                                                union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level])),
+                                     mesh.subdomain(),
+                                     mesh[mesh_id_t::all_cells][level - 1])
+                            .on(level);
+            expr.apply_op(variadic_prediction<pred_order, false>(expected));
+        }
+        EXPECT_TRUE(u.array() == expected.array());
+
+        // a new mesh version gets its own plan
+        auto tag = make_field<int, 1>("tag", mesh, static_cast<int>(CellFlag::refine));
+        update_field(tag, u);
+        EXPECT_NE(detail::ghost_update_plan(mesh), plan);
+    }
 }
@@ -2,6 +2,7 @@
 
 #include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
+#include <samurai/subset/subset_op.hpp>
 
 namespace samurai
 {
@@ -124,4 +125,152 @@ namespace samurai
         xt::xtensor_fixed<int, xt::xshape<2>> coords{1, 2};
         EXPECT_EQ(cell_array.get_cell(2, 2 * coords + 1), (cell_t(2, 3, 5, 8)));
     }
+
+    TEST(cell_array, compact_interval)
+    {
+        constexpr size_t dim = 2;
+        using interval_t     = default_config::compact_interval_t;
+
+        static_assert(sizeof(interval_t) < sizeof(default_config::interval_t));
+
+        CellList<dim, interval_t> cell_list;
+
+        cell_list[1][{1}].add_interval({2, 5});
+        cell_list[2][{5}].add_interval({-2, 8});
+        cell_list[2][{5}].add_interval({9, 10});
+        cell_list[2][{6}].add_interval({10, 12});
+
+        CellArray<dim, interval_t> cell_array(cell_list);
+        EXPECT_EQ(cell_array.get_index(2, 0, 5), 5);
+        EXPECT_EQ(cell_array.get_index(2, 10, 6), 14);
+    }
+
+    TEST(cell_array, compact_interval_overflow)
+    {
+        constexpr size_t dim = 1;
+        using interval_t     = default_config::compact_interval_t;
+
+        // the cell of level 11 has the largest 32-bit index
+        CellList<dim, interval_t> cell_list;
+        cell_list[10][{}].add_interval({-(1 << 30) + 1, 1 << 30});
+        cell_list[11][{}].add_point(0);
+        EXPECT_NO_THROW((CellArray<dim, interval_t>(cell_list)));
+
+        cell_list[11][{}].add_point(1);
+        EXPECT_THROW((CellArray<dim, interval_t>(cell_list)), std::overflow_error);
+    }
+
+    TEST(cell_array, flat_cell_list)
+    {
+        constexpr size_t dim = 2;
+        using interval_t     = default_config::interval_t;
+
+        CellList<dim> cell_list;
+        CellList<dim, interval_t, default_config::max_level, CellListBackend::flat> flat_cell_list;
+
+        auto fill = [](auto& cl)
+        {
+            cl[2][{6}].add_interval({10, 12});
+            cl[1][{1}].add_interval({2, 5});
+            cl[2][{5}].add_interval({9, 10});
+            cl[2][{5}].add_interval({-2, 8});
+        };
+        fill(cell_list);
+        fill(flat_cell_list);
+
+        CellArray<dim> cell_array(cell_list);
+        CellArray<dim> flat_cell_array(flat_cell_list);
+
+        EXPECT_EQ(flat_cell_array, cell_array);
+        EXPECT_EQ(flat_cell_array.get_index(2, 3, 5), 8);
+    }
+
+    TEST(cell_array, from_subset)
+    {
+        constexpr size_t dim = 3;
+
+        CellList<dim> cl;
+        cl[2][{1, 1}].add_interval({0, 3});
+        cl[2][{1, 1}].add_interval({5, 7});
+        cl[2][{2, 1}].add_interval({1, 4});
+        cl[2][{0, 3}].add_interval({2, 4});
+        cl[3][{2, 2}].add_interval({0, 8});
+        cl[3][{3, 2}].add_interval({4, 6});
+        cl[3][{3, 3}].add_interval({9, 12});
+
+        CellArray<dim> ca(cl);
+
+        // projection on coarser, equal and finer levels
+        for (std::size_t ref_level = 1; ref_level <= 4; ++ref_level)
+        {
+            auto set = union_(ca[2], ca[3]).on(ref_level);
+
+            LevelCellList<dim> lcl{ref_level};
+            set(
+                [&](const auto& i, const auto& index)
+                {
+                    lcl[index].add_interval(i);
+                });
+            LevelCellArray<dim> expected(lcl);
+
+            LevelCellArray<dim> lca(set);
+            EXPECT_EQ(lca, expected);
+        }
+    }
+
+    TEST(cell_array, find)
+    {
+        constexpr size_t dim = 2;
+
+        CellList<dim> cl;
+        for (int j = 0; j < 40; ++j)
+        {
+            for (int i = -30; i < 30; i += 1 + (i + j) % 4)
+            {
+                cl[4][{j % 7 == 3 ? j + 1 : j}].add_interval({i, i + 1 + j % 3});
+            }
+        }
+        CellArray<dim> ca(cl);
+        const auto& lca = ca[4];
+
+        for (int j = -2; j < 45; ++j)
+        {
+            for (int i = -35; i < 35; ++i)
+            {
+                xt::xtensor_fixed<int, xt::xshape<dim>> coord{i, j};
+                EXPECT_EQ(find(lca, coord), detail::find_impl(lca, 0, lca[1].size(), coord, std::integral_constant<std::size_t, 1>{}));
+            }
+        }
+    }
+
+    TEST(cell_array, find_batch)
+    {
+        constexpr size_t dim = 2;
+
+        CellList<dim> cl;
+        for (int j = 0; j < 40; ++j)
+        {
+            for (int i = -30; i < 30; i += 1 + (i + j) % 4)
+            {
+                cl[4][{j % 7 == 3 ? j + 1 : j}].add_interval({i, i + 1 + j % 3});
+            }
+        }
+        CellArray<dim> ca(cl);
+        const auto& lca = ca[4];
+
+        // unsorted queries with duplicates and coordinates outside of the mesh
+        std::vector<xt::xtensor_fixed<int, xt::xshape<dim>>> coords;
+        for (int k = 0; k < 5000; ++k)
+        {
+            coords.push_back({(k * 37) % 70 - 35, (k * 13) % 47 - 2});
+        }
+
+        std::vector<default_config::index_t> rows;
+        find_batch(lca, coords, rows);
+        ASSERT_EQ(rows.size(), coords.size());
+        for (std::size_t q = 0; q < coords.size(); ++q)
+        {
+            EXPECT_EQ(rows[q], find(lca, coords[q]));
+        }
+    }
 }
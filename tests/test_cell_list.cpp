@@ -1,5 +1,8 @@
+#include <cstdint>
+
 #include <gtest/gtest.h>
 
+#include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
 
 namespace samurai
@@ -10,4 +13,52 @@ namespace samurai
 
         CellList<dim> cell_list;
     }
+
+    TEST(cell_list, move)
+    {
+        constexpr size_t dim = 2;
+
+        CellList<dim> cl;
+        cl[1][{0}].add_interval({0, 2});
+        cl[1][{1}].add_interval({0, 2});
+
+        CellArray<dim> expected = {cl};
+
+        CellList<dim> cl_moved = std::move(cl);
+        EXPECT_EQ(CellArray<dim>(cl_moved), expected);
+
+        CellList<dim> cl_assigned;
+        cl_assigned[2][{3}].add_point(4);
+        cl_assigned = std::move(cl_moved);
+        EXPECT_EQ(CellArray<dim>(cl_assigned), expected);
+
+        CellList<dim> cl_copy = cl_assigned;
+        cl_assigned.clear();
+        EXPECT_EQ(CellArray<dim>(cl_copy), expected);
+        EXPECT_TRUE(cl_assigned[1].empty());
+
+        cl_assigned[1][{0}].add_interval({0, 2});
+        cl_assigned[1][{1}].add_interval({0, 2});
+        EXPECT_EQ(CellArray<dim>(cl_assigned), expected);
+    }
+
+    TEST(monotonic_arena, allocate)
+    {
+        MonotonicArena arena(64);
+
+        auto* p1 = arena.allocate(3, 1);
+        auto* p2 = arena.allocate(sizeof(double), alignof(double));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p2) % alignof(double), 0u);
+        EXPECT_NE(p1, p2);
+        EXPECT_EQ(arena.nb_blocks(), 1u);
+
+        // does not fit in the first block
+        arena.allocate(1000, 8);
+        EXPECT_EQ(arena.nb_blocks(), 2u);
+        EXPECT_GE(arena.capacity(), 1064u);
+
+        arena.release();
+        EXPECT_EQ(arena.nb_blocks(), 0u);
+        EXPECT_EQ(arena.capacity(), 0u);
+    }
 }
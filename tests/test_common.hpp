@@ -7,8 +7,8 @@
 
 namespace samurai
 {
-    template <typename coord_t, typename index_t>
-    bool operator==(const ListOfIntervals<coord_t, index_t>& li, const xt::xarray<Interval<coord_t, index_t>>& array)
+    template <class List, typename coord_t, typename index_t>
+    bool equal_list(const List& li, const xt::xarray<Interval<coord_t, index_t>>& array)
     {
         auto ix = li.cbegin();
         auto iy = array.cbegin();
@@ -30,4 +30,16 @@ namespace samurai
             return false;
         }
     }
+
+    template <typename coord_t, typename index_t>
+    bool operator==(const ListOfIntervals<coord_t, index_t>& li, const xt::xarray<Interval<coord_t, index_t>>& array)
+    {
+        return equal_list(li, array);
+    }
+
+    template <typename coord_t, typename index_t>
+    bool operator==(const FlatListOfIntervals<coord_t, index_t>& li, const xt::xarray<Interval<coord_t, index_t>>& array)
+    {
+        return equal_list(li, array);
+    }
 }
@@ -0,0 +1,368 @@
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+#endif
+
+#include <xtensor/xfixed.hpp>
+
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+namespace samurai
+{
+    using adapted_mesh_t = MRMesh<MRConfig<2>>;
+
+    // Multiresolution mesh adapted to a bump: the cells have several levels, with level jumps around the bump
+    adapted_mesh_t make_adapted_mesh()
+    {
+        Box<double, 2> box({-1., -1.}, {1., 1.});
+        adapted_mesh_t mesh{box, 2, 6};
+
+        auto u = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return std::exp(-50 * (x[0] * x[0] + x[1] * x[1]));
+                               });
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto adapt = make_MRAdapt(u);
+        adapt(1e-3, 1);
+        return mesh;
+    }
+
+    // Maximum difference between the values of the two fields on the cells
+    template <class Field>
+    double max_difference(Field& f1, Field& f2)
+    {
+        double diff = 0;
+        for_each_cell(f1.mesh(),
+                      [&](const auto& cell)
+                      {
+                          for (std::size_t c = 0; c < Field::size; ++c)
+                          {
+                              diff = std::max(diff, std::abs(field_value(f1, cell, c) - field_value(f2, cell, c)));
+                          }
+                      });
+        return diff;
+    }
+
+    template <class Scheme>
+    Scheme without_interval_flux(const Scheme& scheme)
+    {
+        Scheme per_cell = scheme;
+        for (std::size_t d = 0; d < Scheme::dim; ++d)
+        {
+            per_cell.flux_definition()[d].set_cons_interval_flux_function(nullptr);
+        }
+        return per_cell;
+    }
+
+    // The fluxes computed interval by interval are the same as those computed cell by cell
+    template <class Field>
+    void check_interval_flux(Field& u)
+    {
+        static constexpr double tol = 1e-12;
+
+        const auto& cells = u.mesh()[Field::mesh_t::mesh_id_t::cells];
+        ASSERT_GT(cells.max_level(), cells.min_level()); // level jumps
+
+        make_bc<Dirichlet<1>>(u);
+        update_ghost_mr(u);
+
+        auto conv     = make_convection_upwind<Field>();
+        auto per_cell = without_interval_flux(conv);
+        for (std::size_t d = 0; d < Field::dim; ++d)
+        {
+            EXPECT_TRUE(conv.has_interval_flux(d));
+            EXPECT_FALSE(per_cell.has_interval_flux(d));
+        }
+
+        {
+            auto flux     = conv(u);
+            auto expected = per_cell(u);
+            EXPECT_LT(max_difference(flux, expected), tol);
+        }
+        {
+            auto scaled = -2. * conv;
+            EXPECT_TRUE(scaled.has_interval_flux(0));
+            auto flux     = scaled(u);
+            auto expected = (-2. * per_cell)(u);
+            EXPECT_LT(max_difference(flux, expected), tol);
+        }
+        {
+            auto sum = conv + conv;
+            EXPECT_TRUE(sum.has_interval_flux(0));
+            auto flux     = sum(u);
+            auto expected = (per_cell + per_cell)(u);
+            EXPECT_LT(max_difference(flux, expected), tol);
+        }
+        {
+            auto flux     = make_field<typename Field::value_type, Field::size, Field::is_soa>("flux", u.mesh());
+            auto expected = make_field<typename Field::value_type, Field::size, Field::is_soa>("expected", u.mesh());
+            conv.apply_axpy(flux, 1., u, -0.1);
+            per_cell.apply_axpy(expected, 1., u, -0.1);
+            EXPECT_LT(max_difference(flux, expected), tol);
+        }
+        {
+            auto diff     = make_diffusion_order2<Field>(0.1);
+            auto flux     = make_field<typename Field::value_type, Field::size, Field::is_soa>("flux", u.mesh());
+            auto expected = make_field<typename Field::value_type, Field::size, Field::is_soa>("expected", u.mesh());
+            (diff + conv).apply_axpy(flux, 1., u, -0.1);
+            (diff + per_cell).apply_axpy(expected, 1., u, -0.1);
+            EXPECT_LT(max_difference(flux, expected), tol);
+        }
+    }
+
+    TEST(explicit_scheme, interval_flux_scalar)
+    {
+        auto mesh = make_adapted_mesh();
+        auto u    = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return x[0] * std::exp(-20 * (x[0] * x[0] + x[1] * x[1]));
+                               });
+        check_interval_flux(u);
+    }
+
+    template <bool SOA>
+    void check_interval_flux_vector()
+    {
+        auto mesh = make_adapted_mesh();
+        auto u    = make_field<2, SOA>("u",
+                                    mesh,
+                                    [](const auto& x)
+                                    {
+                                        double bump = std::exp(-20 * (x[0] * x[0] + x[1] * x[1]));
+                                        return xt::xtensor_fixed<double, xt::xshape<2>>{x[1] * bump, -x[0] * bump + 0.1};
+                                    });
+        check_interval_flux(u);
+    }
+
+    TEST(explicit_scheme, interval_flux_vector_aos)
+    {
+        check_interval_flux_vector<false>();
+    }
+
+    TEST(explicit_scheme, interval_flux_vector_soa)
+    {
+        check_interval_flux_vector<true>();
+    }
+
+    // A flux function assigned after make_convection_upwind() replaces its interval version
+    TEST(explicit_scheme, interval_flux_dropped_by_new_flux)
+    {
+        auto mesh = make_adapted_mesh();
+        auto u    = make_field<1>("u", mesh, 1.);
+        make_bc<Dirichlet<1>>(u, 1.);
+        update_ghost_mr(u);
+
+        using field_t = decltype(u);
+        auto conv     = make_convection_upwind<field_t>();
+        for (std::size_t d = 0; d < field_t::dim; ++d)
+        {
+            conv.flux_definition()[d].cons_flux_function = [](auto&, const auto&) -> FluxValue<typename decltype(conv)::cfg_t>
+            {
+                return 0.;
+            };
+            EXPECT_FALSE(conv.has_interval_flux(d));
+        }
+
+        auto flux = conv(u);
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          EXPECT_EQ(flux[cell], 0.);
+                      });
+    }
+
+    // The fused evaluation of a sum of operators gives the same result as the evaluation operator by operator
+    template <class Field>
+    void check_fused_evaluation(Field& u)
+    {
+        static constexpr double tol = 1e-12;
+
+        make_bc<Dirichlet<1>>(u);
+        update_ghost_mr(u);
+
+        auto rhs = make_diffusion_order2<Field>(0.1) + make_convection_upwind<Field>(VelocityVector<2>{1., -0.5})
+                 + make_convection_upwind<Field>();
+
+        auto fused = rhs;
+        fused.fused_evaluation(true);
+        rhs.fused_evaluation(false);
+
+        {
+            auto result   = fused(u);
+            auto expected = rhs(u);
+            EXPECT_LT(max_difference(result, expected), tol);
+        }
+        {
+            auto result   = make_field<typename Field::value_type, Field::size, Field::is_soa>("result", u.mesh());
+            auto expected = make_field<typename Field::value_type, Field::size, Field::is_soa>("expected", u.mesh());
+            fused.apply_axpy(result, 1., u, -0.1);
+            rhs.apply_axpy(expected, 1., u, -0.1);
+            EXPECT_LT(max_difference(result, expected), tol);
+        }
+    }
+
+    TEST(explicit_scheme, fused_evaluation_scalar)
+    {
+        auto mesh = make_adapted_mesh();
+        auto u    = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return x[0] * std::exp(-20 * (x[0] * x[0] + x[1] * x[1]));
+                               });
+        check_fused_evaluation(u);
+    }
+
+    TEST(explicit_scheme, fused_evaluation_vector)
+    {
+        auto mesh = make_adapted_mesh();
+        auto u    = make_field<2>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   double bump = std::exp(-20 * (x[0] * x[0] + x[1] * x[1]));
+                                   return xt::xtensor_fixed<double, xt::xshape<2>>{x[1] * bump, -x[0] * bump + 0.1};
+                               });
+        check_fused_evaluation(u);
+    }
+
+    // Mesh refined up to the boundary x = 1 of the domain, where the bump is centered
+    adapted_mesh_t make_mesh_refined_at_boundary()
+    {
+        Box<double, 2> box({-1., -1.}, {1., 1.});
+        adapted_mesh_t mesh{box, 2, 6};
+
+        auto u = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return std::exp(-50 * ((x[0] - 1) * (x[0] - 1) + x[1] * x[1]));
+                               });
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto adapt = make_MRAdapt(u);
+        adapt(1e-3, 1);
+        return mesh;
+    }
+
+    // Mesh whose cells are of levels 4 and 5 (the finest ones along the boundary x = 1) while its maximum level is 6
+    adapted_mesh_t make_mesh_below_max_level()
+    {
+        using mesh_id_t = adapted_mesh_t::mesh_id_t;
+
+        Box<double, 2> box({-1., -1.}, {1., 1.});
+        adapted_mesh_t mesh{box, 4, 6};
+
+        // the details of a linear function vanish: all the cells are coarsened to the minimum level
+        auto linear = [](const auto& x)
+        {
+            return 0.5 * x[0] + x[1];
+        };
+        auto u = make_field<1>("u", mesh, linear);
+        make_bc<Dirichlet<1>>(u,
+                              [&](const auto&, const auto&, const auto& coords)
+                              {
+                                  return linear(coords);
+                              });
+        auto adapt = make_MRAdapt(u);
+        adapt(1e-3, 1);
+
+        auto tag = make_field<int, 1>("tag", mesh);
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          tag[cell] = static_cast<int>(cell.center(0) > 0.5 ? CellFlag::refine : CellFlag::keep);
+                      });
+        update_field(tag);
+
+        EXPECT_LT(mesh[mesh_id_t::cells].max_level(), mesh.max_level());
+        return mesh;
+    }
+
+    // The ghosts exchanged during the computation give the same result as the ghosts updated beforehand
+    template <class Field, class Scheme>
+    void check_apply_with_ghost_exchange(Field& u, const Scheme& scheme)
+    {
+        static constexpr double tol = 1e-12;
+
+        // non-homogeneous boundary conditions: the boundary ghosts must be updated before they are used
+        make_bc<Dirichlet<1>>(u, 1.);
+        update_ghost_mr(u);
+        // the ghosts are now out of date
+        for_each_cell(u.mesh(),
+                      [&](const auto& cell)
+                      {
+                          u[cell] *= 2;
+                      });
+
+        Field u_ref = u;
+        update_ghost_mr(u_ref);
+        auto expected = make_field<typename Field::value_type, Field::size, Field::is_soa>("expected", u.mesh());
+        expected.fill(0.);
+        scheme.apply(expected, u_ref);
+
+        auto result = make_field<typename Field::value_type, Field::size, Field::is_soa>("result", u.mesh());
+        result.fill(0.);
+        scheme.apply_with_ghost_exchange(result, u);
+        EXPECT_LT(max_difference(result, expected), tol);
+    }
+
+    template <class Mesh>
+    void check_apply_with_ghost_exchange(Mesh& mesh)
+    {
+        auto init_u = [](const auto& x)
+        {
+            return x[0] * std::exp(-20 * (x[0] * x[0] + x[1] * x[1])) + 0.5 * x[1];
+        };
+        using field_t = decltype(make_field<1>("u", mesh));
+
+        {
+            auto u = make_field<1>("u", mesh, init_u);
+            check_apply_with_ghost_exchange(u, make_convection_upwind<field_t>(VelocityVector<2>{1., -0.5}));
+        }
+        {
+            auto u = make_field<1>("u", mesh, init_u);
+            check_apply_with_ghost_exchange(u, make_convection_upwind<field_t>());
+        }
+        {
+            auto u = make_field<1>("u", mesh, init_u);
+            check_apply_with_ghost_exchange(u, make_diffusion_order2<field_t>(0.1));
+        }
+    }
+
+    TEST(explicit_scheme, apply_with_ghost_exchange)
+    {
+        auto mesh = make_adapted_mesh();
+        check_apply_with_ghost_exchange(mesh);
+    }
+
+    TEST(explicit_scheme, apply_with_ghost_exchange_refined_at_boundary)
+    {
+        using mesh_id_t = adapted_mesh_t::mesh_id_t;
+
+        auto mesh = make_mesh_refined_at_boundary();
+
+        std::size_t finest_level = mesh[mesh_id_t::cells].max_level();
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        finest_level = mpi::all_reduce(world, finest_level, mpi::maximum<std::size_t>());
+#endif
+        ASSERT_EQ(finest_level, mesh.max_level());
+        check_apply_with_ghost_exchange(mesh);
+    }
+
+    TEST(explicit_scheme, apply_with_ghost_exchange_below_max_level)
+    {
+        auto mesh = make_mesh_below_max_level();
+        check_apply_with_ghost_exchange(mesh);
+    }
+}
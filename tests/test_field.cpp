@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -140,4 +141,65 @@ namespace samurai
         u.name() = "new_name";
         EXPECT_EQ(u.name(), "new_name");
     }
+
+    TEST(field, storage_reuse)
+    {
+        Box<double, 2> box{{0, 0}, {1, 1}};
+        using Config = UniformConfig<2>;
+        auto mesh    = UniformMesh<Config>(box, 4);
+
+        using data_type = typename decltype(make_field<double, 3>("u", mesh))::data_type;
+        auto& pool      = storage_pool<data_type>();
+        pool.clear();
+
+        const double* data = nullptr;
+        {
+            auto u = make_field<double, 3>("u", mesh);
+            data   = u.array().data();
+        }
+        EXPECT_EQ(pool.nb_buffers(), 1);
+
+        // the memory of the destroyed field is handed out to the next one of the same size
+        std::size_t nb_allocations = pool.nb_allocations();
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            auto v = make_field<double, 3>("v", mesh, 1.);
+            EXPECT_EQ(v.array().data(), data);
+            decltype(v) w = 2. * v;
+            EXPECT_EQ(pool.nb_allocations(), nb_allocations + 1);
+        }
+        EXPECT_EQ(pool.nb_allocations(), nb_allocations + 1);
+
+        // a field of another size does not reuse it
+        auto mesh2 = UniformMesh<Config>(box, 3);
+        auto u2    = make_field<double, 3>("u2", mesh2);
+        EXPECT_NE(u2.array().data(), data);
+    }
+
+    TEST(field, storage_reuse_move_assignment)
+    {
+        Box<double, 2> box{{0, 0}, {1, 1}};
+        using Config = UniformConfig<2>;
+        auto mesh    = UniformMesh<Config>(box, 4);
+
+        using data_type = typename decltype(make_field<double, 3>("u", mesh))::data_type;
+        auto& pool      = storage_pool<data_type>();
+        pool.clear();
+
+        auto u             = make_field<double, 3>("u", mesh, 1.);
+        auto v             = make_field<double, 3>("v", mesh, 2.);
+        const double* data = u.array().data();
+
+        // the memory of the replaced field is given back to the pool
+        u = std::move(v);
+        EXPECT_EQ(pool.nb_buffers(), 1);
+        EXPECT_EQ(pool.nb_bytes(), u.array().size() * sizeof(double));
+        EXPECT_EQ(u.name(), "v");
+        EXPECT_EQ(u.array().data()[0], 2.);
+
+        auto w = make_field<double, 3>("w", mesh);
+        EXPECT_EQ(w.array().data(), data);
+        EXPECT_EQ(pool.nb_buffers(), 0);
+        EXPECT_EQ(pool.nb_bytes(), 0);
+    }
 }
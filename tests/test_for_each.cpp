@@ -1,5 +1,11 @@
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
 #include <gtest/gtest.h>
+
 #include <samurai/amr/mesh.hpp>
+#include <samurai/interface.hpp>
 
 namespace samurai
 {
@@ -83,4 +89,196 @@ namespace samurai
                       });
         EXPECT_EQ(nb_cells, 2);
     }
+
+    TEST(set, parallel_for_each_cell)
+    {
+        constexpr std::size_t dim = 2;
+
+        CellList<dim> cl;
+        cl[2][{1}].add_interval({-3, 4});
+        cl[3][{0}].add_interval({0, 2});
+        cl[3][{5}].add_interval({-20, 30});
+        cl[3][{5}].add_interval({35, 37});
+        cl[5][{-4}].add_interval({1, 200});
+        CellArray<dim> ca(cl);
+
+        std::vector<std::array<int, 3>> expected(ca.nb_cells());
+        for_each_cell(ca,
+                      [&](const auto& cell)
+                      {
+                          expected[static_cast<std::size_t>(cell.index)] = {static_cast<int>(cell.level), cell.indices[0], cell.indices[1]};
+                      });
+
+        auto check = [&](auto run_type)
+        {
+            std::vector<std::array<int, 3>> visited(ca.nb_cells(), {-1, 0, 0});
+            for_each_cell<decltype(run_type)::value>(ca,
+                                                     [&](const auto& cell)
+                                                     {
+                                                         auto& v = visited[static_cast<std::size_t>(cell.index)];
+                                                         EXPECT_EQ(v[0], -1);
+                                                         v = {static_cast<int>(cell.level), cell.indices[0], cell.indices[1]};
+                                                     });
+            EXPECT_EQ(visited, expected);
+        };
+        check(std::integral_constant<Run, Run::Parallel>{});
+        check(std::integral_constant<Run, Run::ParallelStatic>{});
+        check(std::integral_constant<Run, Run::ParallelTasks>{});
+    }
+
+    TEST(set, colored_for_each_interior_interface)
+    {
+        using Config    = amr::Config<2>;
+        using Mesh      = amr::Mesh<Config>;
+        using cl_type   = typename Mesh::cl_type;
+        using mesh_id_t = typename Mesh::mesh_id_t;
+
+        // level 2 on the left half of the domain, level 3 on the right half
+        cl_type cl;
+        for (int j = 0; j < 4; ++j)
+        {
+            cl[2][{j}].add_interval({0, 2});
+        }
+        for (int j = 0; j < 8; ++j)
+        {
+            cl[3][{j}].add_interval({4, 8});
+        }
+        Mesh mesh(cl, 2, 3);
+
+        auto count_visits = [&](auto run_type)
+        {
+            std::vector<int> visits(mesh.nb_cells(), 0);
+            for_each_interior_interface<decltype(run_type)::value>(mesh,
+                                                                  [&](const auto& interface_cells, const auto&)
+                                                                  {
+                                                                      visits[static_cast<std::size_t>(interface_cells[0].index)]++;
+                                                                      visits[static_cast<std::size_t>(interface_cells[1].index)]++;
+                                                                  });
+            return visits;
+        };
+
+        auto expected = count_visits(std::integral_constant<Run, Run::Sequential>{});
+        EXPECT_GT(std::accumulate(expected.begin(), expected.end(), 0), 2 * static_cast<int>(mesh.nb_cells(mesh_id_t::cells)));
+        for (int rep = 0; rep < 10; ++rep)
+        {
+            EXPECT_EQ(count_visits(std::integral_constant<Run, Run::ParallelColored>{}), expected);
+        }
+    }
+
+    TEST(set, interface_plan)
+    {
+        using Config  = amr::Config<2>;
+        using Mesh    = amr::Mesh<Config>;
+        using cl_type = typename Mesh::cl_type;
+
+        // level 2 on the left half of the domain, level 3 on the right half
+        cl_type cl;
+        for (int j = 0; j < 4; ++j)
+        {
+            cl[2][{j}].add_interval({0, 2});
+        }
+        for (int j = 0; j < 8; ++j)
+        {
+            cl[3][{j}].add_interval({4, 8});
+        }
+        Mesh mesh(cl, 2, 3);
+
+        // the cells translated from the first cells of the intervals must be the cells of the mesh
+        auto check_cell = [&](const auto& cell)
+        {
+            EXPECT_EQ(mesh.get_index(cell.level, cell.indices[0], cell.indices[1]), cell.index);
+        };
+
+        auto interfaces = [&](auto run_type)
+        {
+            std::vector<std::array<long long, 2>> visited;
+            for_each_interior_interface<decltype(run_type)::value>(mesh,
+                                                                  [&](const auto& cells, const auto&)
+                                                                  {
+                                                                      check_cell(cells[0]);
+                                                                      check_cell(cells[1]);
+#pragma omp critical
+                                                                      visited.push_back({cells[0].index, cells[1].index});
+                                                                  });
+            std::sort(visited.begin(), visited.end());
+            return visited;
+        };
+
+        // the first call builds the plans, the next ones replay them
+        auto expected = interfaces(std::integral_constant<Run, Run::Sequential>{});
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(interfaces(std::integral_constant<Run, Run::Sequential>{}), expected);
+        EXPECT_EQ(interfaces(std::integral_constant<Run, Run::Parallel>{}), expected);
+        EXPECT_EQ(interfaces(std::integral_constant<Run, Run::ParallelColored>{}), expected);
+
+        // the copies share the version of the mesh, a new mesh has its own one
+        Mesh copy = mesh;
+        EXPECT_EQ(copy.version(), mesh.version());
+        cl_type uniform_cl;
+        for (int j = 0; j < 4; ++j)
+        {
+            uniform_cl[2][{j}].add_interval({0, 4});
+        }
+        Mesh uniform(uniform_cl, 2, 2);
+        EXPECT_NE(uniform.version(), mesh.version());
+
+        auto version = mesh.version();
+        mesh.swap(uniform);
+        EXPECT_EQ(uniform.version(), version);
+        EXPECT_NE(mesh.version(), version);
+    }
+
+    TEST(set, interface_selection)
+    {
+        using Config  = amr::Config<2>;
+        using Mesh    = amr::Mesh<Config>;
+        using cl_type = typename Mesh::cl_type;
+
+        cl_type cl;
+        for (int j = 0; j < 4; ++j)
+        {
+            cl[2][{j}].add_interval({0, 2});
+        }
+        for (int j = 0; j < 8; ++j)
+        {
+            cl[3][{j}].add_interval({4, 8});
+        }
+        Mesh mesh(cl, 2, 3);
+
+        auto interfaces = [&]()
+        {
+            std::vector<std::array<long long, 2>> visited;
+            for_each_interior_interface<Run::Parallel>(mesh,
+                                                       [&](const auto& cells, const auto&)
+                                                       {
+#pragma omp critical
+                                                           visited.push_back({cells[0].index, cells[1].index});
+                                                       });
+            std::sort(visited.begin(), visited.end());
+            return visited;
+        };
+
+        auto expected = interfaces();
+
+        // the interfaces away from the halo and near the halo are a partition of all the interfaces
+        std::vector<std::array<long long, 2>> away;
+        std::vector<std::array<long long, 2>> near;
+        {
+            detail::ScopedInterfaceSelection selection(InterfaceSelection::away_from_halo);
+            away = interfaces();
+        }
+        {
+            detail::ScopedInterfaceSelection selection(InterfaceSelection::near_halo);
+            near = interfaces();
+        }
+        EXPECT_EQ(detail::interface_selection(), InterfaceSelection::all);
+
+        std::vector<std::array<long long, 2>> merged;
+        std::merge(away.begin(), away.end(), near.begin(), near.end(), std::back_inserter(merged));
+        EXPECT_EQ(merged, expected);
+#ifndef SAMURAI_WITH_MPI
+        // without MPI, no ghost is in flight
+        EXPECT_TRUE(near.empty());
+#endif
+    }
 }
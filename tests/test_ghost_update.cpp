@@ -0,0 +1,70 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <xtensor/xfixed.hpp>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/bc.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    // Sets the values of the cells from @param f and 0 in the ghosts
+    template <class Field, class Function>
+    void init_cells(Field& field, Function&& f)
+    {
+        field.fill(0.);
+        for_each_cell(field.mesh(),
+                      [&](const auto& cell)
+                      {
+                          field[cell] = f(cell.center());
+                      });
+    }
+
+    // The ghosts of several fields updated together are the same as those of the fields updated one by one
+    TEST(ghost_update, several_fields)
+    {
+        using mesh_t = MRMesh<MRConfig<2>>;
+
+        Box<double, 2> box({-1., -1.}, {1., 1.});
+        mesh_t mesh{box, 2, 6};
+
+        auto bump = [](const auto& x)
+        {
+            return std::exp(-50 * ((x[0] - 0.2) * (x[0] - 0.2) + x[1] * x[1]));
+        };
+        auto u = make_field<1>("u", mesh, bump);
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto adapt = make_MRAdapt(u);
+        adapt(1e-3, 1);
+
+        auto v = make_field<2, true>("v", mesh);
+        make_bc<Dirichlet<1>>(v, 1., -1.);
+
+        // twice, so that the second exchange reuses the buffers of the first one
+        for (double scale : {1., 2.})
+        {
+            init_cells(u,
+                       [&](const auto& x)
+                       {
+                           return scale * x[0] * bump(x);
+                       });
+            init_cells(v,
+                       [&](const auto& x)
+                       {
+                           return xt::xtensor_fixed<double, xt::xshape<2>>{scale * x[1], x[0] - scale};
+                       });
+            auto u_ref = u;
+            auto v_ref = v;
+
+            update_ghost_mr(u, v);
+            update_ghost_mr(u_ref);
+            update_ghost_mr(v_ref);
+
+            EXPECT_EQ(u.array(), u_ref.array());
+            EXPECT_EQ(v.array(), v_ref.array());
+        }
+    }
+}
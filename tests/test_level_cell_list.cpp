@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <xtensor/xarray.hpp>
 
+#include <samurai/level_cell_array.hpp>
 #include <samurai/level_cell_list.hpp>
 
 namespace samurai
@@ -11,4 +12,32 @@ namespace samurai
         LevelCellList<dim> lcl;
         lcl[{0}].add_interval({-3, 3});
     }
+
+    TEST(level_cell_list, flat_backend)
+    {
+        constexpr size_t dim = 3;
+        LevelCellList<dim, default_config::interval_t, CellListBackend::map> lcl_map(4);
+        LevelCellList<dim, default_config::interval_t, CellListBackend::flat> lcl_flat(4);
+
+        auto fill = [](auto& lcl)
+        {
+            lcl[{2, 1}].add_interval({0, 4});
+            lcl[{0, 3}].add_interval({-2, 1});
+            lcl[{1, 1}].add_interval({5, 6});
+            lcl[{1, 1}].add_interval({-1, 2});
+            lcl[{0, 1}].add_interval({3, 6});
+            lcl[{3, 1}].add_point(7);
+            lcl[{2, 1}].add_interval({3, 8});
+        };
+        fill(lcl_map);
+        fill(lcl_flat);
+
+        EXPECT_EQ(lcl_flat.nb_rows(), 5u);
+        EXPECT_EQ(lcl_flat[{2, 1}].size(), 1u);
+        EXPECT_TRUE(lcl_flat[{5, 5}].empty());
+
+        LevelCellArray<dim> lca_map(lcl_map);
+        LevelCellArray<dim> lca_flat(lcl_flat);
+        EXPECT_EQ(lca_flat, lca_map);
+    }
 }
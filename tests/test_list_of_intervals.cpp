@@ -95,6 +95,30 @@ namespace samurai
         EXPECT_EQ(list.size(), 1u);
     }
 
+    TEST(list_of_intervals, add_interval_last)
+    {
+        ListOfIntervals<int, int> list;
+        xt::xarray<Interval<int, int>> expected{
+            {-5, 12},
+            {20, 21},
+            {30, 32}
+        };
+        list.add_interval({0, 2});
+        list.add_interval({4, 6});
+        list.add_interval({5, 8});
+        // the last interval is merged with the previous ones
+        list.add_interval({-5, 4});
+
+        // the last interval is tracked through copies and moves
+        auto copy = list;
+        copy.add_interval({8, 12});
+        ListOfIntervals<int, int> moved = std::move(copy);
+        moved.add_point(20);
+        list = moved;
+        list.add_interval({30, 32});
+        EXPECT_EQ(list, expected);
+    }
+
     TEST(list_of_intervals, ostream)
     {
         ListOfIntervals<int, int> list;
@@ -104,4 +128,63 @@ namespace samurai
         ss << list;
         EXPECT_STREQ(ss.str().data(), "[2,3[@0:1 [4,7[@0:1 ");
     }
+
+    TEST(flat_list_of_intervals, add_interval)
+    {
+        FlatListOfIntervals<int, int> list;
+        xt::xarray<Interval<int, int>> expected{
+            {-10, -5},
+            {-3,  3 },
+            {5,   10}
+        };
+        list.add_interval({5, 10});
+        list.add_interval({-3, 3});
+        list.add_interval({-10, -5});
+        EXPECT_EQ(list, expected);
+    }
+
+    TEST(flat_list_of_intervals, add_interval_intersection)
+    {
+        FlatListOfIntervals<int, int> list;
+        xt::xarray<Interval<int, int>> expected{
+            {-10, 12}
+        };
+        list.add_interval({-10, -5});
+        list.add_interval({-3, 3});
+        list.add_interval({5, 10});
+        list.add_interval({-5, 12});
+        EXPECT_EQ(list, expected);
+    }
+
+    TEST(flat_list_of_intervals, add_points)
+    {
+        FlatListOfIntervals<int, int> list;
+
+        int size  = 1000;
+        auto perm = -size / 2 + xt::random::permutation<int>(size);
+        for (auto p : perm)
+        {
+            list.add_point(p);
+        }
+
+        xt::xarray<Interval<int, int>> expected{
+            {-size / 2, size / 2}
+        };
+        EXPECT_EQ(list, expected);
+    }
+
+    TEST(flat_list_of_intervals, size)
+    {
+        FlatListOfIntervals<int, int> list;
+        EXPECT_EQ(list.size(), 0u);
+
+        list.add_point(3);
+        EXPECT_EQ(list.size(), 1u);
+
+        list.add_point(5);
+        EXPECT_EQ(list.size(), 2u);
+
+        list.add_point(4);
+        EXPECT_EQ(list.size(), 1u);
+    }
 }
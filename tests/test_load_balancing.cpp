@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+#endif
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    using balanced_mesh_t = MRMesh<MRConfig<2>>;
+
+    struct space_filling_curve_config : MRConfig<2>
+    {
+        static constexpr LoadBalancingMethod load_balancing_method = LoadBalancingMethod::space_filling_curve;
+    };
+
+    // Mesh refined around a bump away from the center of the domain, so that the subdomains have different loads
+    template <class Mesh = balanced_mesh_t>
+    Mesh make_unbalanced_mesh()
+    {
+        Box<double, 2> box({-1., -1.}, {1., 1.});
+        Mesh mesh{box, 2, 6};
+
+        auto u = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return std::exp(-50 * ((x[0] - 0.5) * (x[0] - 0.5) + (x[1] - 0.3) * (x[1] - 0.3)));
+                               });
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto adapt = make_MRAdapt(u);
+        adapt(1e-3, 1);
+        return mesh;
+    }
+
+    template <class Mesh>
+    std::size_t global_nb_cells(const Mesh& mesh)
+    {
+        std::size_t nb_cells = mesh.nb_cells(Mesh::mesh_id_t::cells);
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        nb_cells = mpi::all_reduce(world, nb_cells, std::plus<std::size_t>());
+#endif
+        return nb_cells;
+    }
+
+    // Number of cells in the intersection of two level cell arrays
+    template <class LCA>
+    std::size_t nb_common_cells(const LCA& lca1, const LCA& lca2)
+    {
+        std::size_t nb_cells = 0;
+        intersection(lca1, lca2)(
+            [&](const auto& interval, const auto&)
+            {
+                nb_cells += interval.size();
+            });
+        return nb_cells;
+    }
+
+    // The load flux between two neighbours is antisymmetric, so that the total load is conserved
+    TEST(load_balancing, load_fluxes)
+    {
+        auto mesh   = make_unbalanced_mesh();
+        auto fluxes = mesh.load_fluxes();
+        ASSERT_EQ(fluxes.size(), mesh.mpi_neighbourhood().size());
+
+        std::vector<int> neighbours;
+        for (const auto& neighbour : mesh.mpi_neighbourhood())
+        {
+            neighbours.push_back(neighbour.rank);
+        }
+
+        // neighbours and fluxes of each rank
+        std::vector<std::vector<int>> all_neighbours{neighbours};
+        std::vector<std::vector<double>> all_fluxes{fluxes};
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        mpi::all_gather(world, neighbours, all_neighbours);
+        mpi::all_gather(world, fluxes, all_fluxes);
+#endif
+
+        double total = 0;
+        for (std::size_t rank = 0; rank < all_fluxes.size(); ++rank)
+        {
+            for (std::size_t i = 0; i < all_fluxes[rank].size(); ++i)
+            {
+                total += all_fluxes[rank][i];
+
+                auto neighbour        = static_cast<std::size_t>(all_neighbours[rank][i]);
+                const auto& opposites = all_neighbours[neighbour];
+                auto opposite         = std::find(opposites.begin(), opposites.end(), static_cast<int>(rank));
+                ASSERT_NE(opposite, opposites.end());
+                auto j = static_cast<std::size_t>(opposite - opposites.begin());
+                EXPECT_NEAR(all_fluxes[rank][i], -all_fluxes[neighbour][j], 1e-9);
+            }
+        }
+        EXPECT_NEAR(total, 0., 1e-9);
+    }
+
+    // The cells sent to a neighbour belong to the subdomain, are sent to a single neighbour and don't exceed the load flux
+    TEST(load_balancing, load_transfer)
+    {
+        using mesh_id_t = balanced_mesh_t::mesh_id_t;
+
+        auto mesh          = make_unbalanced_mesh();
+        auto fluxes        = mesh.load_fluxes();
+        auto cells_to_send = mesh.load_balancing();
+        ASSERT_EQ(cells_to_send.size(), mesh.mpi_neighbourhood().size());
+
+        for (std::size_t i = 0; i < cells_to_send.size(); ++i)
+        {
+            auto nb_sent = cells_to_send[i].nb_cells();
+            if (fluxes[i] >= 0)
+            {
+                EXPECT_EQ(nb_sent, 0u);
+            }
+            else
+            {
+                EXPECT_LE(static_cast<double>(nb_sent), -fluxes[i]);
+            }
+
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                EXPECT_EQ(nb_common_cells(cells_to_send[i][level], mesh[mesh_id_t::cells][level]), cells_to_send[i][level].nb_cells());
+                for (std::size_t j = 0; j < i; ++j)
+                {
+                    EXPECT_EQ(nb_common_cells(cells_to_send[i][level], cells_to_send[j][level]), 0u);
+                }
+            }
+        }
+    }
+
+    // The migration of the cells decreases the load imbalance, keeps the number of cells and the values of the fields
+    template <class Mesh>
+    void check_load_balance(const LoadBalancingOptions& options = {})
+    {
+        using mesh_id_t = typename Mesh::mesh_id_t;
+
+        auto mesh      = make_unbalanced_mesh<Mesh>();
+        auto u         = make_field<1>("u",
+                               mesh,
+                               [](const auto& x)
+                               {
+                                   return x[0] + 2 * x[1];
+                               });
+        auto before    = global_nb_cells(mesh);
+        auto imbalance = mesh.load_imbalance(options.level_weights);
+        auto cells     = mesh[mesh_id_t::cells];
+
+        bool migrated = load_balance(options, u);
+
+        EXPECT_EQ(migrated, imbalance > options.max_imbalance);
+        EXPECT_EQ(global_nb_cells(mesh), before);
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          EXPECT_NEAR(u[cell], cell.center(0) + 2 * cell.center(1), 1e-12);
+                      });
+        if (!migrated)
+        {
+            EXPECT_EQ(mesh[mesh_id_t::cells], cells);
+            return;
+        }
+        EXPECT_LT(mesh.load_imbalance(options.level_weights), imbalance);
+
+        // number of cells which have left the subdomains
+        std::size_t nb_sent = 0;
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            nb_sent += cells[level].nb_cells() - nb_common_cells(cells[level], mesh[mesh_id_t::cells][level]);
+        }
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        nb_sent = mpi::all_reduce(world, nb_sent, std::plus<std::size_t>());
+#endif
+        EXPECT_GT(nb_sent, 0u);
+    }
+
+    TEST(load_balancing, load_balance)
+    {
+        check_load_balance<balanced_mesh_t>();
+        // a larger threshold than the imbalance leaves the mesh untouched
+        check_load_balance<balanced_mesh_t>({std::numeric_limits<double>::max(), load_balancing_iterations, {}});
+    }
+
+    TEST(load_balancing, load_balance_space_filling_curve)
+    {
+        using mesh_t = MRMesh<space_filling_curve_config>;
+        static_assert(detail::config_load_balancing_method<mesh_t::config>::value == LoadBalancingMethod::space_filling_curve);
+
+        check_load_balance<mesh_t>();
+        // the cells of the finest levels cost more
+        check_load_balance<mesh_t>({load_balancing_max_imbalance, load_balancing_iterations, {1., 1., 1., 1., 2., 4., 8.}});
+    }
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm.hpp>
+#include <samurai/box.hpp>
+#include <samurai/level_cell_array.hpp>
+#include <samurai/level_cell_list.hpp>
+#include <samurai/space_filling_curve.hpp>
+
+namespace samurai
+{
+    TEST(space_filling_curve, morton_key)
+    {
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{0, 0}), 0u);
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{1, 0}), 1u);
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{0, 1}), 2u);
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{1, 1}), 3u);
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{2, 0}), 4u);
+        EXPECT_EQ(morton_key<2>(std::array<int, 2>{3, 5}), 39u);
+
+        EXPECT_EQ(morton_key<3>(std::array<int, 3>{1, 0, 1}), 5u);
+        EXPECT_EQ(morton_key<3>(std::array<int, 3>{2, 2, 2}), 56u);
+    }
+
+    template <std::size_t dim>
+    void check_morton_partition(const Box<int, dim>& box, std::size_t nb_parts)
+    {
+        constexpr std::size_t level = 4;
+
+        LevelCellArray<dim> expected(level, box);
+        LevelCellList<dim> all_parts{level};
+        std::size_t nb_cells = 0;
+
+        std::uint64_t previous_max_key = 0;
+        for (std::size_t part = 0; part < nb_parts; ++part)
+        {
+            LevelCellList<dim> lcl{level};
+            morton_partition(box, nb_parts, part, lcl);
+            LevelCellArray<dim> lca{lcl};
+
+            // balanced parts
+            EXPECT_LE(lca.nb_cells(), expected.nb_cells() / nb_parts + 1);
+            EXPECT_GE(lca.nb_cells(), expected.nb_cells() / nb_parts);
+            nb_cells += lca.nb_cells();
+
+            // the parts follow each other along the curve
+            std::uint64_t min_key = std::numeric_limits<std::uint64_t>::max();
+            std::uint64_t max_key = 0;
+            for_each_cell(lca,
+                          [&](const auto& cell)
+                          {
+                              std::array<int, dim> shifted;
+                              for (std::size_t d = 0; d < dim; ++d)
+                              {
+                                  shifted[d] = cell.indices[d] - box.min_corner()[d];
+                              }
+                              auto key = morton_key<dim>(shifted);
+                              min_key  = std::min(min_key, key);
+                              max_key  = std::max(max_key, key);
+                          });
+            if (part > 0)
+            {
+                EXPECT_GT(min_key, previous_max_key);
+            }
+            previous_max_key = max_key;
+
+            for_each_interval(lca,
+                              [&](std::size_t, const auto& i, const auto& index)
+                              {
+                                  all_parts[index].add_interval(i);
+                              });
+        }
+
+        // the parts cover the box exactly once
+        EXPECT_EQ(nb_cells, expected.nb_cells());
+        EXPECT_EQ(LevelCellArray<dim>(all_parts), expected);
+    }
+
+    TEST(space_filling_curve, morton_partition_2d)
+    {
+        using point_t = Box<int, 2>::point_t;
+        Box<int, 2> box(point_t{-3, 1}, point_t{10, 6});
+
+        for (std::size_t nb_parts : {1u, 2u, 3u, 5u, 7u})
+        {
+            check_morton_partition(box, nb_parts);
+        }
+    }
+
+    TEST(space_filling_curve, morton_partition_3d)
+    {
+        using point_t = Box<int, 3>::point_t;
+        Box<int, 3> box(point_t{0, 0, 0}, point_t{5, 3, 6});
+
+        for (std::size_t nb_parts : {1u, 4u, 6u})
+        {
+            check_morton_partition(box, nb_parts);
+        }
+    }
+}